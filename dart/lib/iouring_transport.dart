@@ -4,7 +4,7 @@ export 'package:iouring_transport/transport/transport.dart' show Transport;
 
 export 'package:iouring_transport/transport/client/configuration.dart' show TransportTcpClientConfiguration, TransportUdpClientConfiguration, TransportUnixStreamClientConfiguration;
 export 'package:iouring_transport/transport/configuration.dart'
-    show TransportUdpMulticastConfiguration, TransportUdpMulticastManager, TransportUdpMulticastSourceConfiguration, TransportWorkerConfiguration;
+    show TransportUdpMulticastConfiguration, TransportUdpMulticastManager, TransportUdpMulticastSourceConfiguration, TransportWorkerConfiguration, TransportBufferClassConfiguration, TransportFraming;
 export 'package:iouring_transport/transport/server/configuration.dart' show TransportTcpServerConfiguration, TransportUdpServerConfiguration, TransportUnixStreamServerConfiguration;
 export 'package:iouring_transport/transport/defaults.dart' show TransportDefaults;
 
@@ -17,8 +17,13 @@ export 'package:iouring_transport/transport/client/provider.dart' show Transport
 export 'package:iouring_transport/transport/server/factory.dart' show TransportServersFactory;
 export 'package:iouring_transport/transport/server/provider.dart' show TransportServerConnection, TransportServerDatagramReceiver;
 export 'package:iouring_transport/transport/server/responder.dart' show TransportServerDatagramResponder;
+export 'package:iouring_transport/transport/server/server.dart' show TransportServer;
 
 export 'package:iouring_transport/transport/file/factory.dart' show TransportFilesFactory;
 export 'package:iouring_transport/transport/file/provider.dart' show TransportFile;
 
+export 'package:iouring_transport/transport/proxy/factory.dart' show TransportProxiesFactory;
+export 'package:iouring_transport/transport/proxy/provider.dart' show TransportProxy;
+
 export 'package:iouring_transport/transport/payload.dart' show TransportPayload;
+export 'package:iouring_transport/transport/lease.dart' show TransportBufferLease;
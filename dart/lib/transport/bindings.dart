@@ -9503,117 +9503,6 @@ class TransportBindings {
 
   set signgam(int value) => _signgam.value = value;
 
-  ffi.Pointer<mh_events_t> mh_events_new() {
-    return _mh_events_new();
-  }
-
-  late final _mh_events_newPtr = _lookup<ffi.NativeFunction<ffi.Pointer<mh_events_t> Function()>>('mh_events_new');
-  late final _mh_events_new = _mh_events_newPtr.asFunction<ffi.Pointer<mh_events_t> Function()>();
-
-  void mh_events_clear(
-    ffi.Pointer<mh_events_t> h,
-  ) {
-    return _mh_events_clear(
-      h,
-    );
-  }
-
-  late final _mh_events_clearPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<mh_events_t>)>>('mh_events_clear');
-  late final _mh_events_clear = _mh_events_clearPtr.asFunction<void Function(ffi.Pointer<mh_events_t>)>();
-
-  void mh_events_delete(
-    ffi.Pointer<mh_events_t> h,
-  ) {
-    return _mh_events_delete(
-      h,
-    );
-  }
-
-  late final _mh_events_deletePtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<mh_events_t>)>>('mh_events_delete');
-  late final _mh_events_delete = _mh_events_deletePtr.asFunction<void Function(ffi.Pointer<mh_events_t>)>();
-
-  void mh_events_resize(
-    ffi.Pointer<mh_events_t> h,
-    int arg,
-  ) {
-    return _mh_events_resize(
-      h,
-      arg,
-    );
-  }
-
-  late final _mh_events_resizePtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<mh_events_t>, ffi.Uint64)>>('mh_events_resize');
-  late final _mh_events_resize = _mh_events_resizePtr.asFunction<void Function(ffi.Pointer<mh_events_t>, int)>();
-
-  int mh_events_start_resize(
-    ffi.Pointer<mh_events_t> h,
-    int buckets,
-    int batch,
-    int arg,
-  ) {
-    return _mh_events_start_resize(
-      h,
-      buckets,
-      batch,
-      arg,
-    );
-  }
-
-  late final _mh_events_start_resizePtr = _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<mh_events_t>, mh_int_t, mh_int_t, ffi.Uint64)>>('mh_events_start_resize');
-  late final _mh_events_start_resize = _mh_events_start_resizePtr.asFunction<int Function(ffi.Pointer<mh_events_t>, int, int, int)>();
-
-  int mh_events_reserve(
-    ffi.Pointer<mh_events_t> h,
-    int size,
-    int arg,
-  ) {
-    return _mh_events_reserve(
-      h,
-      size,
-      arg,
-    );
-  }
-
-  late final _mh_events_reservePtr = _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<mh_events_t>, mh_int_t, ffi.Uint64)>>('mh_events_reserve');
-  late final _mh_events_reserve = _mh_events_reservePtr.asFunction<int Function(ffi.Pointer<mh_events_t>, int, int)>();
-
-  void mh_events_del_resize(
-    ffi.Pointer<mh_events_t> h,
-    int x,
-    int arg,
-  ) {
-    return _mh_events_del_resize(
-      h,
-      x,
-      arg,
-    );
-  }
-
-  late final _mh_events_del_resizePtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<mh_events_t>, mh_int_t, ffi.Uint64)>>('mh_events_del_resize');
-  late final _mh_events_del_resize = _mh_events_del_resizePtr.asFunction<void Function(ffi.Pointer<mh_events_t>, int, int)>();
-
-  int mh_events_memsize(
-    ffi.Pointer<mh_events_t> h,
-  ) {
-    return _mh_events_memsize(
-      h,
-    );
-  }
-
-  late final _mh_events_memsizePtr = _lookup<ffi.NativeFunction<ffi.Size Function(ffi.Pointer<mh_events_t>)>>('mh_events_memsize');
-  late final _mh_events_memsize = _mh_events_memsizePtr.asFunction<int Function(ffi.Pointer<mh_events_t>)>();
-
-  void mh_events_dump(
-    ffi.Pointer<mh_events_t> h,
-  ) {
-    return _mh_events_dump(
-      h,
-    );
-  }
-
-  late final _mh_events_dumpPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<mh_events_t>)>>('mh_events_dump');
-  late final _mh_events_dump = _mh_events_dumpPtr.asFunction<void Function(ffi.Pointer<mh_events_t>)>();
-
   int transport_server_initialize_tcp(
     ffi.Pointer<transport_server_t> server,
     ffi.Pointer<transport_server_configuration_t> configuration,
@@ -9719,9 +9608,33 @@ class TransportBindings {
   }
 
   late final _transport_worker_writePtr =
-      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Uint32, ffi.Int64, ffi.Uint16, ffi.Uint8)>>('transport_worker_write');
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Int64, ffi.Uint16, ffi.Uint8)>>('transport_worker_write');
   late final _transport_worker_write = _transport_worker_writePtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int, int, int, int, int, int)>(isLeaf: true);
 
+  int transport_worker_write_vector(
+    ffi.Pointer<transport_worker_t> worker,
+    int fd,
+    int count,
+    int offset,
+    int timeout,
+    int event,
+    int sqe_flags,
+  ) {
+    return _transport_worker_write_vector(
+      worker,
+      fd,
+      count,
+      offset,
+      timeout,
+      event,
+      sqe_flags,
+    );
+  }
+
+  late final _transport_worker_write_vectorPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Int64, ffi.Uint16, ffi.Uint8)>>('transport_worker_write_vector');
+  late final _transport_worker_write_vector = _transport_worker_write_vectorPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>, int, int, int, int, int, int)>(isLeaf: true);
+
   void transport_worker_read(
     ffi.Pointer<transport_worker_t> worker,
     int fd,
@@ -9743,9 +9656,31 @@ class TransportBindings {
   }
 
   late final _transport_worker_readPtr =
-      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Uint32, ffi.Int64, ffi.Uint16, ffi.Uint8)>>('transport_worker_read');
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Int64, ffi.Uint16, ffi.Uint8)>>('transport_worker_read');
   late final _transport_worker_read = _transport_worker_readPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int, int, int, int, int, int)>(isLeaf: true);
 
+  void transport_worker_send_zero_copy(
+    ffi.Pointer<transport_worker_t> worker,
+    int fd,
+    int buffer_id,
+    int timeout,
+    int event,
+    int sqe_flags,
+  ) {
+    return _transport_worker_send_zero_copy(
+      worker,
+      fd,
+      buffer_id,
+      timeout,
+      event,
+      sqe_flags,
+    );
+  }
+
+  late final _transport_worker_send_zero_copyPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32, ffi.Int64, ffi.Uint16, ffi.Uint8)>>('transport_worker_send_zero_copy');
+  late final _transport_worker_send_zero_copy = _transport_worker_send_zero_copyPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int, int, int, int, int)>(isLeaf: true);
+
   void transport_worker_send_message(
     ffi.Pointer<transport_worker_t> worker,
     int fd,
@@ -9771,11 +9706,40 @@ class TransportBindings {
   }
 
   late final _transport_worker_send_messagePtr =
-      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Pointer<sockaddr>, ffi.Int32, ffi.Int, ffi.Int64, ffi.Uint16, ffi.Uint8)>>(
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32, ffi.Pointer<sockaddr>, ffi.Int32, ffi.Int, ffi.Int64, ffi.Uint16, ffi.Uint8)>>(
           'transport_worker_send_message');
   late final _transport_worker_send_message =
       _transport_worker_send_messagePtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int, int, ffi.Pointer<sockaddr>, int, int, int, int, int)>(isLeaf: true);
 
+  void transport_worker_send_message_zero_copy(
+    ffi.Pointer<transport_worker_t> worker,
+    int fd,
+    int buffer_id,
+    ffi.Pointer<sockaddr> address,
+    int socket_family,
+    int message_flags,
+    int timeout,
+    int event,
+    int sqe_flags,
+  ) {
+    return _transport_worker_send_message_zero_copy(
+      worker,
+      fd,
+      buffer_id,
+      address,
+      socket_family,
+      message_flags,
+      timeout,
+      event,
+      sqe_flags,
+    );
+  }
+
+  late final _transport_worker_send_message_zero_copyPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32, ffi.Pointer<sockaddr>, ffi.Int32, ffi.Int, ffi.Int64, ffi.Uint16, ffi.Uint8)>>('transport_worker_send_message_zero_copy');
+  late final _transport_worker_send_message_zero_copy =
+      _transport_worker_send_message_zero_copyPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int, int, ffi.Pointer<sockaddr>, int, int, int, int, int)>(isLeaf: true);
+
   void transport_worker_receive_message(
     ffi.Pointer<transport_worker_t> worker,
     int fd,
@@ -9799,192 +9763,546 @@ class TransportBindings {
   }
 
   late final _transport_worker_receive_messagePtr =
-      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Int32, ffi.Int, ffi.Int64, ffi.Uint16, ffi.Uint8)>>('transport_worker_receive_message');
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32, ffi.Int32, ffi.Int, ffi.Int64, ffi.Uint16, ffi.Uint8)>>('transport_worker_receive_message');
   late final _transport_worker_receive_message = _transport_worker_receive_messagePtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int, int, int, int, int, int, int)>(isLeaf: true);
 
-  void transport_worker_connect(
+  void transport_worker_read_multishot(
     ffi.Pointer<transport_worker_t> worker,
-    ffi.Pointer<transport_client_t> client,
+    int fd,
     int timeout,
+    int event,
+    int sqe_flags,
   ) {
-    return _transport_worker_connect(
+    return _transport_worker_read_multishot(
       worker,
-      client,
+      fd,
       timeout,
+      event,
+      sqe_flags,
     );
   }
 
-  late final _transport_worker_connectPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_client_t>, ffi.Int64)>>('transport_worker_connect');
-  late final _transport_worker_connect = _transport_worker_connectPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_client_t>, int)>(isLeaf: true);
+  late final _transport_worker_read_multishotPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Int64, ffi.Uint16, ffi.Uint8)>>('transport_worker_read_multishot');
+  late final _transport_worker_read_multishot = _transport_worker_read_multishotPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int, int, int, int)>(isLeaf: true);
 
-  void transport_worker_accept(
+  int transport_worker_read_framed(
     ffi.Pointer<transport_worker_t> worker,
-    ffi.Pointer<transport_server_t> server,
+    int fd,
+    int mode,
+    int length_size,
+    int delimiter,
+    int max_frame_size,
+    int timeout,
+    int event,
   ) {
-    return _transport_worker_accept(
+    return _transport_worker_read_framed(
       worker,
-      server,
+      fd,
+      mode,
+      length_size,
+      delimiter,
+      max_frame_size,
+      timeout,
+      event,
     );
   }
 
-  late final _transport_worker_acceptPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_server_t>)>>('transport_worker_accept');
-  late final _transport_worker_accept = _transport_worker_acceptPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_server_t>)>(isLeaf: true);
+  late final _transport_worker_read_framedPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint8, ffi.Uint8, ffi.Uint8, ffi.Uint32, ffi.Int64, ffi.Uint16)>>('transport_worker_read_framed');
+  late final _transport_worker_read_framed =
+      _transport_worker_read_framedPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>, int, int, int, int, int, int, int)>(isLeaf: true);
 
-  void transport_worker_cancel_by_fd(
+  void transport_worker_clear_framing(
     ffi.Pointer<transport_worker_t> worker,
     int fd,
   ) {
-    return _transport_worker_cancel_by_fd(
+    return _transport_worker_clear_framing(
       worker,
       fd,
     );
   }
 
-  late final _transport_worker_cancel_by_fdPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Int)>>('transport_worker_cancel_by_fd');
-  late final _transport_worker_cancel_by_fd = _transport_worker_cancel_by_fdPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
+  late final _transport_worker_clear_framingPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32)>>('transport_worker_clear_framing');
+  late final _transport_worker_clear_framing = _transport_worker_clear_framingPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
 
-  void transport_worker_check_event_timeouts(
+  int transport_worker_read_stream(
     ffi.Pointer<transport_worker_t> worker,
+    int fd,
+    int buffer_id,
+    int timeout,
+    int event,
   ) {
-    return _transport_worker_check_event_timeouts(
+    return _transport_worker_read_stream(
       worker,
+      fd,
+      buffer_id,
+      timeout,
+      event,
     );
   }
 
-  late final _transport_worker_check_event_timeoutsPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_check_event_timeouts');
-  late final _transport_worker_check_event_timeouts = _transport_worker_check_event_timeoutsPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
+  late final _transport_worker_read_streamPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32, ffi.Int64, ffi.Uint16)>>('transport_worker_read_stream');
+  late final _transport_worker_read_stream = _transport_worker_read_streamPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>, int, int, int, int)>(isLeaf: true);
 
-  void transport_worker_remove_event(
+  void transport_worker_clear_stream(
     ffi.Pointer<transport_worker_t> worker,
-    int data,
+    int fd,
   ) {
-    return _transport_worker_remove_event(
+    return _transport_worker_clear_stream(
       worker,
-      data,
+      fd,
     );
   }
 
-  late final _transport_worker_remove_eventPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint64)>>('transport_worker_remove_event');
-  late final _transport_worker_remove_event = _transport_worker_remove_eventPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
+  late final _transport_worker_clear_streamPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32)>>('transport_worker_clear_stream');
+  late final _transport_worker_clear_stream = _transport_worker_clear_streamPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
 
-  int transport_worker_get_buffer(
+  int transport_worker_send_file(
     ffi.Pointer<transport_worker_t> worker,
+    int fd,
+    int source_fd,
+    int offset,
+    int length,
+    int chunk_size,
+    int timeout,
+    int event,
   ) {
-    return _transport_worker_get_buffer(
+    return _transport_worker_send_file(
       worker,
+      fd,
+      source_fd,
+      offset,
+      length,
+      chunk_size,
+      timeout,
+      event,
     );
   }
 
-  late final _transport_worker_get_bufferPtr = _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_get_buffer');
-  late final _transport_worker_get_buffer = _transport_worker_get_bufferPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
+  late final _transport_worker_send_filePtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32, ffi.Uint64, ffi.Uint64, ffi.Uint32, ffi.Int64, ffi.Uint16)>>('transport_worker_send_file');
+  late final _transport_worker_send_file =
+      _transport_worker_send_filePtr.asFunction<int Function(ffi.Pointer<transport_worker_t>, int, int, int, int, int, int, int)>(isLeaf: true);
 
-  void transport_worker_release_buffer(
+  int transport_worker_proxy(
     ffi.Pointer<transport_worker_t> worker,
-    int buffer_id,
+    int fd,
+    int peer_fd,
+    int chunk_size,
   ) {
-    return _transport_worker_release_buffer(
+    return _transport_worker_proxy(
       worker,
-      buffer_id,
+      fd,
+      peer_fd,
+      chunk_size,
     );
   }
 
-  late final _transport_worker_release_bufferPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint16)>>('transport_worker_release_buffer');
-  late final _transport_worker_release_buffer = _transport_worker_release_bufferPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
+  late final _transport_worker_proxyPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32, ffi.Uint32)>>('transport_worker_proxy');
+  late final _transport_worker_proxy = _transport_worker_proxyPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>, int, int, int)>(isLeaf: true);
 
-  int transport_worker_available_buffers(
+  void transport_worker_close_proxy(
     ffi.Pointer<transport_worker_t> worker,
+    int id,
   ) {
-    return _transport_worker_available_buffers(
+    return _transport_worker_close_proxy(
       worker,
+      id,
     );
   }
 
-  late final _transport_worker_available_buffersPtr = _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_available_buffers');
-  late final _transport_worker_available_buffers = _transport_worker_available_buffersPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
+  late final _transport_worker_close_proxyPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32)>>('transport_worker_close_proxy');
+  late final _transport_worker_close_proxy = _transport_worker_close_proxyPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
 
-  int transport_worker_used_buffers(
+  void transport_worker_release_proxy(
     ffi.Pointer<transport_worker_t> worker,
+    int id,
   ) {
-    return _transport_worker_used_buffers(
+    return _transport_worker_release_proxy(
       worker,
+      id,
     );
   }
 
-  late final _transport_worker_used_buffersPtr = _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_used_buffers');
-  late final _transport_worker_used_buffers = _transport_worker_used_buffersPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
+  late final _transport_worker_release_proxyPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32)>>('transport_worker_release_proxy');
+  late final _transport_worker_release_proxy = _transport_worker_release_proxyPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
 
-  ffi.Pointer<sockaddr> transport_worker_get_datagram_address(
+  void transport_worker_connect(
     ffi.Pointer<transport_worker_t> worker,
-    int socket_family,
-    int buffer_id,
+    ffi.Pointer<transport_client_t> client,
+    int timeout,
   ) {
-    return _transport_worker_get_datagram_address(
+    return _transport_worker_connect(
       worker,
-      socket_family,
-      buffer_id,
+      client,
+      timeout,
     );
   }
 
-  late final _transport_worker_get_datagram_addressPtr =
-      _lookup<ffi.NativeFunction<ffi.Pointer<sockaddr> Function(ffi.Pointer<transport_worker_t>, ffi.Int32, ffi.Int)>>('transport_worker_get_datagram_address');
-  late final _transport_worker_get_datagram_address = _transport_worker_get_datagram_addressPtr.asFunction<ffi.Pointer<sockaddr> Function(ffi.Pointer<transport_worker_t>, int, int)>(isLeaf: true);
+  late final _transport_worker_connectPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_client_t>, ffi.Int64)>>('transport_worker_connect');
+  late final _transport_worker_connect = _transport_worker_connectPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_client_t>, int)>(isLeaf: true);
 
-  int transport_worker_peek(
+  void transport_worker_accept(
     ffi.Pointer<transport_worker_t> worker,
+    ffi.Pointer<transport_server_t> server,
   ) {
-    return _transport_worker_peek(
+    return _transport_worker_accept(
       worker,
+      server,
     );
   }
 
-  late final _transport_worker_peekPtr = _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_peek');
-  late final _transport_worker_peek = _transport_worker_peekPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
+  late final _transport_worker_acceptPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_server_t>)>>('transport_worker_accept');
+  late final _transport_worker_accept = _transport_worker_acceptPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_server_t>)>(isLeaf: true);
 
-  void transport_worker_destroy(
+  void transport_worker_accept_multishot(
     ffi.Pointer<transport_worker_t> worker,
+    ffi.Pointer<transport_server_t> server,
   ) {
-    return _transport_worker_destroy(
+    return _transport_worker_accept_multishot(
       worker,
+      server,
     );
   }
 
-  late final _transport_worker_destroyPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_destroy');
-  late final _transport_worker_destroy = _transport_worker_destroyPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
+  late final _transport_worker_accept_multishotPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_server_t>)>>('transport_worker_accept_multishot');
+  late final _transport_worker_accept_multishot = _transport_worker_accept_multishotPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_server_t>)>(isLeaf: true);
 
-  int transport_file_open(
-    ffi.Pointer<ffi.Char> path,
-    int mode,
-    bool truncate,
-    bool create,
+  void transport_worker_cancel_by_fd(
+    ffi.Pointer<transport_worker_t> worker,
+    int fd,
   ) {
-    return _transport_file_open(
-      path,
-      mode,
-      truncate,
-      create,
+    return _transport_worker_cancel_by_fd(
+      worker,
+      fd,
     );
   }
 
-  late final _transport_file_openPtr = _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<ffi.Char>, ffi.Int, ffi.Bool, ffi.Bool)>>('transport_file_open');
-  late final _transport_file_open = _transport_file_openPtr.asFunction<int Function(ffi.Pointer<ffi.Char>, int, bool, bool)>();
+  late final _transport_worker_cancel_by_fdPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Int)>>('transport_worker_cancel_by_fd');
+  late final _transport_worker_cancel_by_fd = _transport_worker_cancel_by_fdPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
 
-  int transport_socket_create_tcp(
-    int flags,
-    int socket_receive_buffer_size,
-    int socket_send_buffer_size,
-    int socket_receive_low_at,
-    int socket_send_low_at,
-    int ip_ttl,
-    int tcp_keep_alive_idle,
-    int tcp_keep_alive_max_count,
-    int tcp_keep_alive_individual_count,
-    int tcp_max_segment_size,
-    int tcp_syn_count,
+  int transport_worker_register_file(
+    ffi.Pointer<transport_worker_t> worker,
+    int fd,
   ) {
-    return _transport_socket_create_tcp(
-      flags,
-      socket_receive_buffer_size,
-      socket_send_buffer_size,
+    return _transport_worker_register_file(
+      worker,
+      fd,
+    );
+  }
+
+  late final _transport_worker_register_filePtr = _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_worker_t>, ffi.Int)>>('transport_worker_register_file');
+  late final _transport_worker_register_file = _transport_worker_register_filePtr.asFunction<int Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
+
+  void transport_worker_unregister_file(
+    ffi.Pointer<transport_worker_t> worker,
+    int fd,
+  ) {
+    return _transport_worker_unregister_file(
+      worker,
+      fd,
+    );
+  }
+
+  late final _transport_worker_unregister_filePtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Int)>>('transport_worker_unregister_file');
+  late final _transport_worker_unregister_file = _transport_worker_unregister_filePtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
+
+  void transport_worker_check_event_timeouts(
+    ffi.Pointer<transport_worker_t> worker,
+  ) {
+    return _transport_worker_check_event_timeouts(
+      worker,
+    );
+  }
+
+  late final _transport_worker_check_event_timeoutsPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_check_event_timeouts');
+  late final _transport_worker_check_event_timeouts = _transport_worker_check_event_timeoutsPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
+
+  void transport_worker_remove_event(
+    ffi.Pointer<transport_worker_t> worker,
+    int data,
+  ) {
+    return _transport_worker_remove_event(
+      worker,
+      data,
+    );
+  }
+
+  late final _transport_worker_remove_eventPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint64)>>('transport_worker_remove_event');
+  late final _transport_worker_remove_event = _transport_worker_remove_eventPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
+
+  void transport_worker_touch_event(
+    ffi.Pointer<transport_worker_t> worker,
+    int data,
+  ) {
+    return _transport_worker_touch_event(
+      worker,
+      data,
+    );
+  }
+
+  late final _transport_worker_touch_eventPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint64)>>('transport_worker_touch_event');
+  late final _transport_worker_touch_event = _transport_worker_touch_eventPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
+
+  int transport_worker_get_buffer(
+    ffi.Pointer<transport_worker_t> worker,
+  ) {
+    return _transport_worker_get_buffer(
+      worker,
+    );
+  }
+
+  late final _transport_worker_get_bufferPtr = _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_get_buffer');
+  late final _transport_worker_get_buffer = _transport_worker_get_bufferPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
+
+  int transport_worker_get_buffer_sized(
+    ffi.Pointer<transport_worker_t> worker,
+    int size,
+  ) {
+    return _transport_worker_get_buffer_sized(
+      worker,
+      size,
+    );
+  }
+
+  late final _transport_worker_get_buffer_sizedPtr = _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint32)>>('transport_worker_get_buffer_sized');
+  late final _transport_worker_get_buffer_sized = _transport_worker_get_buffer_sizedPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
+
+  int transport_worker_select_buffer_class(
+    ffi.Pointer<transport_worker_t> worker,
+    int size,
+  ) {
+    return _transport_worker_select_buffer_class(
+      worker,
+      size,
+    );
+  }
+
+  late final _transport_worker_select_buffer_classPtr = _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint32)>>('transport_worker_select_buffer_class');
+  late final _transport_worker_select_buffer_class = _transport_worker_select_buffer_classPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
+
+  void transport_worker_release_buffer(
+    ffi.Pointer<transport_worker_t> worker,
+    int buffer_id,
+  ) {
+    return _transport_worker_release_buffer(
+      worker,
+      buffer_id,
+    );
+  }
+
+  late final _transport_worker_release_bufferPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32)>>('transport_worker_release_buffer');
+  late final _transport_worker_release_buffer = _transport_worker_release_bufferPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
+
+  int transport_worker_share_buffer(
+    ffi.Pointer<transport_worker_t> worker,
+    int buffer_id,
+    int count,
+  ) {
+    return _transport_worker_share_buffer(
+      worker,
+      buffer_id,
+      count,
+    );
+  }
+
+  late final _transport_worker_share_bufferPtr = _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32)>>('transport_worker_share_buffer');
+  late final _transport_worker_share_buffer = _transport_worker_share_bufferPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>, int, int)>(isLeaf: true);
+
+  int transport_worker_available_buffers(
+    ffi.Pointer<transport_worker_t> worker,
+  ) {
+    return _transport_worker_available_buffers(
+      worker,
+    );
+  }
+
+  late final _transport_worker_available_buffersPtr = _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_available_buffers');
+  late final _transport_worker_available_buffers = _transport_worker_available_buffersPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
+
+  int transport_worker_used_buffers(
+    ffi.Pointer<transport_worker_t> worker,
+  ) {
+    return _transport_worker_used_buffers(
+      worker,
+    );
+  }
+
+  late final _transport_worker_used_buffersPtr = _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_used_buffers');
+  late final _transport_worker_used_buffers = _transport_worker_used_buffersPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
+
+  int transport_worker_available_class_buffers(
+    ffi.Pointer<transport_worker_t> worker,
+    int buffer_class,
+  ) {
+    return _transport_worker_available_class_buffers(
+      worker,
+      buffer_class,
+    );
+  }
+
+  late final _transport_worker_available_class_buffersPtr = _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint8)>>('transport_worker_available_class_buffers');
+  late final _transport_worker_available_class_buffers = _transport_worker_available_class_buffersPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
+
+  int transport_worker_used_class_buffers(
+    ffi.Pointer<transport_worker_t> worker,
+    int buffer_class,
+  ) {
+    return _transport_worker_used_class_buffers(
+      worker,
+      buffer_class,
+    );
+  }
+
+  late final _transport_worker_used_class_buffersPtr = _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint8)>>('transport_worker_used_class_buffers');
+  late final _transport_worker_used_class_buffers = _transport_worker_used_class_buffersPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>, int)>(isLeaf: true);
+
+  int transport_worker_grow_buffers(
+    ffi.Pointer<transport_worker_t> worker,
+  ) {
+    return _transport_worker_grow_buffers(
+      worker,
+    );
+  }
+
+  late final _transport_worker_grow_buffersPtr = _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_grow_buffers');
+  late final _transport_worker_grow_buffers = _transport_worker_grow_buffersPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
+
+  int transport_worker_shrink_buffers(
+    ffi.Pointer<transport_worker_t> worker,
+  ) {
+    return _transport_worker_shrink_buffers(
+      worker,
+    );
+  }
+
+  late final _transport_worker_shrink_buffersPtr = _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_shrink_buffers');
+  late final _transport_worker_shrink_buffers = _transport_worker_shrink_buffersPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
+
+  ffi.Pointer<sockaddr> transport_worker_get_datagram_address(
+    ffi.Pointer<transport_worker_t> worker,
+    int socket_family,
+    int buffer_id,
+  ) {
+    return _transport_worker_get_datagram_address(
+      worker,
+      socket_family,
+      buffer_id,
+    );
+  }
+
+  late final _transport_worker_get_datagram_addressPtr =
+      _lookup<ffi.NativeFunction<ffi.Pointer<sockaddr> Function(ffi.Pointer<transport_worker_t>, ffi.Int32, ffi.Int)>>('transport_worker_get_datagram_address');
+  late final _transport_worker_get_datagram_address = _transport_worker_get_datagram_addressPtr.asFunction<ffi.Pointer<sockaddr> Function(ffi.Pointer<transport_worker_t>, int, int)>(isLeaf: true);
+
+  int transport_worker_peek(
+    ffi.Pointer<transport_worker_t> worker,
+  ) {
+    return _transport_worker_peek(
+      worker,
+    );
+  }
+
+  late final _transport_worker_peekPtr = _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_peek');
+  late final _transport_worker_peek = _transport_worker_peekPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
+
+  int transport_worker_drain(
+    ffi.Pointer<transport_worker_t> worker,
+  ) {
+    return _transport_worker_drain(
+      worker,
+    );
+  }
+
+  late final _transport_worker_drainPtr = _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_drain');
+  late final _transport_worker_drain = _transport_worker_drainPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
+
+  bool transport_worker_park(
+    ffi.Pointer<transport_worker_t> worker,
+  ) {
+    return _transport_worker_park(
+      worker,
+    );
+  }
+
+  late final _transport_worker_parkPtr = _lookup<ffi.NativeFunction<ffi.Bool Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_park');
+  late final _transport_worker_park = _transport_worker_parkPtr.asFunction<bool Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
+
+  int transport_worker_start_wakeups(
+    ffi.Pointer<transport_worker_t> worker,
+    ffi.Pointer<ffi.NativeFunction<ffi.Void Function()>> callback,
+  ) {
+    return _transport_worker_start_wakeups(
+      worker,
+      callback,
+    );
+  }
+
+  late final _transport_worker_start_wakeupsPtr =
+      _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<ffi.NativeFunction<ffi.Void Function()>>)>>('transport_worker_start_wakeups');
+  late final _transport_worker_start_wakeups =
+      _transport_worker_start_wakeupsPtr.asFunction<int Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<ffi.NativeFunction<ffi.Void Function()>>)>(isLeaf: true);
+
+  void transport_worker_stop_wakeups(
+    ffi.Pointer<transport_worker_t> worker,
+  ) {
+    return _transport_worker_stop_wakeups(
+      worker,
+    );
+  }
+
+  late final _transport_worker_stop_wakeupsPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_stop_wakeups');
+  late final _transport_worker_stop_wakeups = _transport_worker_stop_wakeupsPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
+
+  void transport_worker_destroy(
+    ffi.Pointer<transport_worker_t> worker,
+  ) {
+    return _transport_worker_destroy(
+      worker,
+    );
+  }
+
+  late final _transport_worker_destroyPtr = _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>)>>('transport_worker_destroy');
+  late final _transport_worker_destroy = _transport_worker_destroyPtr.asFunction<void Function(ffi.Pointer<transport_worker_t>)>(isLeaf: true);
+
+  int transport_file_open(
+    ffi.Pointer<ffi.Char> path,
+    int mode,
+    bool truncate,
+    bool create,
+  ) {
+    return _transport_file_open(
+      path,
+      mode,
+      truncate,
+      create,
+    );
+  }
+
+  late final _transport_file_openPtr = _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<ffi.Char>, ffi.Int, ffi.Bool, ffi.Bool)>>('transport_file_open');
+  late final _transport_file_open = _transport_file_openPtr.asFunction<int Function(ffi.Pointer<ffi.Char>, int, bool, bool)>();
+
+  int transport_socket_create_tcp(
+    int flags,
+    int socket_receive_buffer_size,
+    int socket_send_buffer_size,
+    int socket_receive_low_at,
+    int socket_send_low_at,
+    int ip_ttl,
+    int tcp_keep_alive_idle,
+    int tcp_keep_alive_max_count,
+    int tcp_keep_alive_individual_count,
+    int tcp_max_segment_size,
+    int tcp_syn_count,
+  ) {
+    return _transport_socket_create_tcp(
+      flags,
+      socket_receive_buffer_size,
+      socket_send_buffer_size,
       socket_receive_low_at,
       socket_send_low_at,
       ip_ttl,
@@ -10923,15 +11241,6 @@ class _SymbolAddresses {
   ffi.Pointer<ffi.NativeFunction<ffi.Float Function(ffi.Float, ffi.Float, ffi.Float)>> get fmaf => _library._fmafPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Float Function(ffi.Float, ffi.Float)>> get scalbf => _library._scalbfPtr;
   ffi.Pointer<ffi.Int> get signgam => _library._signgam;
-  ffi.Pointer<ffi.NativeFunction<ffi.Pointer<mh_events_t> Function()>> get mh_events_new => _library._mh_events_newPtr;
-  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<mh_events_t>)>> get mh_events_clear => _library._mh_events_clearPtr;
-  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<mh_events_t>)>> get mh_events_delete => _library._mh_events_deletePtr;
-  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<mh_events_t>, ffi.Uint64)>> get mh_events_resize => _library._mh_events_resizePtr;
-  ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<mh_events_t>, mh_int_t, mh_int_t, ffi.Uint64)>> get mh_events_start_resize => _library._mh_events_start_resizePtr;
-  ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<mh_events_t>, mh_int_t, ffi.Uint64)>> get mh_events_reserve => _library._mh_events_reservePtr;
-  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<mh_events_t>, mh_int_t, ffi.Uint64)>> get mh_events_del_resize => _library._mh_events_del_resizePtr;
-  ffi.Pointer<ffi.NativeFunction<ffi.Size Function(ffi.Pointer<mh_events_t>)>> get mh_events_memsize => _library._mh_events_memsizePtr;
-  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<mh_events_t>)>> get mh_events_dump => _library._mh_events_dumpPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_server_t>, ffi.Pointer<transport_server_configuration_t>, ffi.Pointer<ffi.Char>, ffi.Int32)>>
       get transport_server_initialize_tcp => _library._transport_server_initialize_tcpPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_server_t>, ffi.Pointer<transport_server_configuration_t>, ffi.Pointer<ffi.Char>, ffi.Int32)>>
@@ -10941,26 +11250,63 @@ class _SymbolAddresses {
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_server_t>)>> get transport_server_destroy => _library._transport_server_destroyPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_worker_configuration_t>, ffi.Uint8)>> get transport_worker_initialize =>
       _library._transport_worker_initializePtr;
-  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Uint32, ffi.Int64, ffi.Uint16, ffi.Uint8)>> get transport_worker_write =>
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Int64, ffi.Uint16, ffi.Uint8)>> get transport_worker_write =>
       _library._transport_worker_writePtr;
-  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Uint32, ffi.Int64, ffi.Uint16, ffi.Uint8)>> get transport_worker_read =>
+  ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Int64, ffi.Uint16, ffi.Uint8)>> get transport_worker_write_vector =>
+      _library._transport_worker_write_vectorPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Int64, ffi.Uint16, ffi.Uint8)>> get transport_worker_read =>
       _library._transport_worker_readPtr;
-  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Pointer<sockaddr>, ffi.Int32, ffi.Int, ffi.Int64, ffi.Uint16, ffi.Uint8)>>
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32, ffi.Int64, ffi.Uint16, ffi.Uint8)>> get transport_worker_send_zero_copy =>
+      _library._transport_worker_send_zero_copyPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32, ffi.Pointer<sockaddr>, ffi.Int32, ffi.Int, ffi.Int64, ffi.Uint16, ffi.Uint8)>>
       get transport_worker_send_message => _library._transport_worker_send_messagePtr;
-  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint16, ffi.Int32, ffi.Int, ffi.Int64, ffi.Uint16, ffi.Uint8)>>
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32, ffi.Pointer<sockaddr>, ffi.Int32, ffi.Int, ffi.Int64, ffi.Uint16, ffi.Uint8)>> get transport_worker_send_message_zero_copy =>
+      _library._transport_worker_send_message_zero_copyPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32, ffi.Int32, ffi.Int, ffi.Int64, ffi.Uint16, ffi.Uint8)>>
       get transport_worker_receive_message => _library._transport_worker_receive_messagePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Int64, ffi.Uint16, ffi.Uint8)>> get transport_worker_read_multishot =>
+      _library._transport_worker_read_multishotPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint8, ffi.Uint8, ffi.Uint8, ffi.Uint32, ffi.Int64, ffi.Uint16)>> get transport_worker_read_framed =>
+      _library._transport_worker_read_framedPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32)>> get transport_worker_clear_framing => _library._transport_worker_clear_framingPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32, ffi.Int64, ffi.Uint16)>> get transport_worker_read_stream =>
+      _library._transport_worker_read_streamPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32)>> get transport_worker_clear_stream => _library._transport_worker_clear_streamPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32, ffi.Uint64, ffi.Uint64, ffi.Uint32, ffi.Int64, ffi.Uint16)>> get transport_worker_send_file =>
+      _library._transport_worker_send_filePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32, ffi.Uint32)>> get transport_worker_proxy => _library._transport_worker_proxyPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32)>> get transport_worker_close_proxy => _library._transport_worker_close_proxyPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32)>> get transport_worker_release_proxy => _library._transport_worker_release_proxyPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_client_t>, ffi.Int64)>> get transport_worker_connect => _library._transport_worker_connectPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_server_t>)>> get transport_worker_accept => _library._transport_worker_acceptPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<transport_server_t>)>> get transport_worker_accept_multishot =>
+      _library._transport_worker_accept_multishotPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Int)>> get transport_worker_cancel_by_fd => _library._transport_worker_cancel_by_fdPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_worker_t>, ffi.Int)>> get transport_worker_register_file => _library._transport_worker_register_filePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Int)>> get transport_worker_unregister_file => _library._transport_worker_unregister_filePtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>)>> get transport_worker_check_event_timeouts => _library._transport_worker_check_event_timeoutsPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint64)>> get transport_worker_remove_event => _library._transport_worker_remove_eventPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint64)>> get transport_worker_touch_event => _library._transport_worker_touch_eventPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>)>> get transport_worker_get_buffer => _library._transport_worker_get_bufferPtr;
-  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint16)>> get transport_worker_release_buffer => _library._transport_worker_release_bufferPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint32)>> get transport_worker_get_buffer_sized => _library._transport_worker_get_buffer_sizedPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint32)>> get transport_worker_select_buffer_class => _library._transport_worker_select_buffer_classPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>, ffi.Uint32)>> get transport_worker_release_buffer => _library._transport_worker_release_bufferPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint32, ffi.Uint32)>> get transport_worker_share_buffer => _library._transport_worker_share_bufferPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>)>> get transport_worker_available_buffers => _library._transport_worker_available_buffersPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>)>> get transport_worker_used_buffers => _library._transport_worker_used_buffersPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint8)>> get transport_worker_available_class_buffers =>
+      _library._transport_worker_available_class_buffersPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>, ffi.Uint8)>> get transport_worker_used_class_buffers => _library._transport_worker_used_class_buffersPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>)>> get transport_worker_grow_buffers => _library._transport_worker_grow_buffersPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<transport_worker_t>)>> get transport_worker_shrink_buffers => _library._transport_worker_shrink_buffersPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Pointer<sockaddr> Function(ffi.Pointer<transport_worker_t>, ffi.Int32, ffi.Int)>> get transport_worker_get_datagram_address =>
       _library._transport_worker_get_datagram_addressPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_worker_t>)>> get transport_worker_peek => _library._transport_worker_peekPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_worker_t>)>> get transport_worker_drain => _library._transport_worker_drainPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Bool Function(ffi.Pointer<transport_worker_t>)>> get transport_worker_park => _library._transport_worker_parkPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<transport_worker_t>, ffi.Pointer<ffi.NativeFunction<ffi.Void Function()>>)>> get transport_worker_start_wakeups =>
+      _library._transport_worker_start_wakeupsPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>)>> get transport_worker_stop_wakeups => _library._transport_worker_stop_wakeupsPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<transport_worker_t>)>> get transport_worker_destroy => _library._transport_worker_destroyPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<ffi.Char>, ffi.Int, ffi.Bool, ffi.Bool)>> get transport_file_open => _library._transport_file_openPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Int64 Function(ffi.Uint64, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Uint16, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Uint32, ffi.Uint16)>>
@@ -13140,193 +13486,552 @@ abstract class transport_socket_family {
   static const int UNIX = 1;
 }
 
-final class transport_buffers_pool extends ffi.Struct {
-  external ffi.Pointer<ffi.Int32> ids;
+final class transport_buffers_pool extends ffi.Struct {
+  external ffi.Pointer<ffi.Int32> ids;
+
+  @ffi.Size()
+  external int count;
+
+  @ffi.Size()
+  external int size;
+}
+
+final class transport_buffers_class extends ffi.Struct {
+  @ffi.Uint32()
+  external int size;
+
+  @ffi.Uint32()
+  external int first;
+
+  @ffi.Uint32()
+  external int count;
+
+  external transport_buffers_pool free_buffers;
+}
+
+final class transport_buffers_chunk extends ffi.Struct {
+  external ffi.Pointer<ffi.Void> memory;
+
+  @ffi.Size()
+  external int size;
+
+  @ffi.Uint32()
+  external int first;
+
+  @ffi.Uint32()
+  external int count;
+}
+
+final class transport_client_configuration extends ffi.Struct {
+  @ffi.Uint64()
+  external int socket_configuration_flags;
+
+  @ffi.Uint32()
+  external int socket_receive_buffer_size;
+
+  @ffi.Uint32()
+  external int socket_send_buffer_size;
+
+  @ffi.Uint32()
+  external int socket_receive_low_at;
+
+  @ffi.Uint32()
+  external int socket_send_low_at;
+
+  @ffi.Uint16()
+  external int ip_ttl;
+
+  @ffi.Uint32()
+  external int tcp_keep_alive_idle;
+
+  @ffi.Uint32()
+  external int tcp_keep_alive_max_count;
+
+  @ffi.Uint32()
+  external int tcp_keep_alive_individual_count;
+
+  @ffi.Uint32()
+  external int tcp_max_segment_size;
+
+  @ffi.Uint16()
+  external int tcp_syn_count;
+
+  external ffi.Pointer<ip_mreqn> ip_multicast_interface;
+
+  @ffi.Uint32()
+  external int ip_multicast_ttl;
+}
+
+final class transport_client extends ffi.Struct {
+  @ffi.Int()
+  external int fd;
+
+  external sockaddr_in inet_destination_address;
+
+  external sockaddr_in inet_source_address;
+
+  external sockaddr_un unix_destination_address;
+
+  external sockaddr_un unix_source_address;
+
+  @socklen_t()
+  external int client_address_length;
+
+  @ffi.Int32()
+  external int family;
+}
+
+typedef transport_client_t = transport_client;
+typedef transport_client_configuration_t = transport_client_configuration;
+
+final class transport_event extends ffi.Struct {
+  @ffi.Uint64()
+  external int data;
+
+  @ffi.Uint32()
+  external int timeout;
+
+  @ffi.Uint32()
+  external int link;
+}
+
+final class transport_events extends ffi.Struct {
+  external ffi.Pointer<transport_event> buffers;
+
+  @ffi.Uint32()
+  external int buffers_count;
+
+  external ffi.Pointer<transport_event> descriptors;
+
+  @ffi.Uint32()
+  external int descriptors_capacity;
+
+  external ffi.Pointer<transport_event> splices;
+
+  @ffi.Uint32()
+  external int splices_count;
+}
+
+final class transport_tag extends ffi.Struct {
+  external transport_event event;
+
+  @ffi.Uint32()
+  external int fd;
+
+  @ffi.Uint32()
+  external int buffer_id;
+
+  @ffi.Uint32()
+  external int generation;
+
+  @ffi.Uint32()
+  external int next;
+
+  @ffi.Uint16()
+  external int code;
+}
+
+final class transport_tags extends ffi.Struct {
+  external ffi.Pointer<transport_tag> entries;
+
+  @ffi.Uint32()
+  external int capacity;
+
+  @ffi.Uint32()
+  external int free;
+
+  @ffi.Uint32()
+  external int count;
+}
+
+final class transport_vector extends ffi.Struct {
+  external ffi.Pointer<iovec> iovecs;
+
+  @ffi.Uint32()
+  external int capacity;
+
+  @ffi.Uint32()
+  external int count;
+
+  @ffi.Uint32()
+  external int index;
+
+  @ffi.Uint64()
+  external int offset;
+
+  @ffi.Size()
+  external int total;
+
+  @ffi.Size()
+  external int done;
+
+  @ffi.Int64()
+  external int timeout;
+}
+
+final class transport_vectors extends ffi.Struct {
+  external ffi.Pointer<transport_vector> entries;
+
+  @ffi.Uint32()
+  external int capacity;
+}
+
+final class transport_framer extends ffi.Struct {
+  @ffi.Uint8()
+  external int mode;
+
+  @ffi.Uint8()
+  external int length_size;
+
+  @ffi.Uint8()
+  external int delimiter;
+
+  @ffi.Uint16()
+  external int event;
+
+  @ffi.Uint32()
+  external int max_frame_size;
+
+  @ffi.Int64()
+  external int timeout;
+
+  external ffi.Pointer<ffi.Uint8> pending;
+
+  @ffi.Uint32()
+  external int pending_start;
+
+  @ffi.Uint32()
+  external int pending_size;
+
+  @ffi.Uint32()
+  external int pending_capacity;
+}
+
+final class transport_framers extends ffi.Struct {
+  external ffi.Pointer<transport_framer> entries;
+
+  @ffi.Uint32()
+  external int capacity;
+}
+
+final class transport_frame extends ffi.Struct {
+  @ffi.Uint32()
+  external int offset;
+
+  @ffi.Uint32()
+  external int size;
+
+  @ffi.Uint32()
+  external int consumed;
+}
+
+final class transport_server_configuration extends ffi.Struct {
+  @ffi.Int32()
+  external int socket_max_connections;
+
+  @ffi.Uint64()
+  external int socket_configuration_flags;
+
+  @ffi.Uint32()
+  external int socket_receive_buffer_size;
+
+  @ffi.Uint32()
+  external int socket_send_buffer_size;
+
+  @ffi.Uint32()
+  external int socket_receive_low_at;
+
+  @ffi.Uint32()
+  external int socket_send_low_at;
+
+  @ffi.Uint16()
+  external int ip_ttl;
+
+  @ffi.Uint32()
+  external int tcp_keep_alive_idle;
+
+  @ffi.Uint32()
+  external int tcp_keep_alive_max_count;
+
+  @ffi.Uint32()
+  external int tcp_keep_alive_individual_count;
+
+  @ffi.Uint32()
+  external int tcp_max_segment_size;
+
+  @ffi.Uint16()
+  external int tcp_syn_count;
+
+  external ffi.Pointer<ip_mreqn> ip_multicast_interface;
+
+  @ffi.Uint32()
+  external int ip_multicast_ttl;
+}
+
+final class transport_server extends ffi.Struct {
+  @ffi.Int()
+  external int fd;
+
+  @ffi.Int32()
+  external int family;
+
+  external sockaddr_in inet_server_address;
+
+  external sockaddr_un unix_server_address;
+
+  @socklen_t()
+  external int server_address_length;
+}
+
+typedef transport_server_t = transport_server;
+typedef transport_server_configuration_t = transport_server_configuration;
+
+final class transport_splice extends ffi.Struct {
+  @ffi.Array.multi([2])
+  external ffi.Array<ffi.Int> pipe;
+
+  @ffi.Uint32()
+  external int pipe_size;
+
+  @ffi.Uint32()
+  external int fd;
+
+  @ffi.Uint32()
+  external int source_fd;
+
+  @ffi.Uint64()
+  external int offset;
+
+  @ffi.Uint64()
+  external int remaining;
+
+  @ffi.Uint32()
+  external int chunk_size;
+
+  @ffi.Uint32()
+  external int requested;
+
+  @ffi.Uint32()
+  external int buffered;
+
+  @ffi.Uint64()
+  external int transferred;
+
+  @ffi.Bool()
+  external bool broken;
+
+  @ffi.Bool()
+  external bool proxy;
+
+  @ffi.Bool()
+  external bool closing;
+
+  @ffi.Uint32()
+  external int peer;
+
+  @ffi.Int32()
+  external int error;
+
+  @ffi.Int64()
+  external int timeout;
+
+  @ffi.Uint16()
+  external int event;
+
+  @ffi.Uint64()
+  external int poll;
+}
+
+final class transport_splices extends ffi.Struct {
+  external ffi.Pointer<transport_splice> entries;
 
-  @ffi.Size()
-  external int count;
+  @ffi.Uint32()
+  external int capacity;
 
-  @ffi.Size()
-  external int size;
+  external transport_buffers_pool free;
 }
 
-final class transport_client_configuration extends ffi.Struct {
-  @ffi.Uint64()
-  external int socket_configuration_flags;
+final class transport_stream extends ffi.Struct {
+  @ffi.Bool()
+  external bool armed;
 
-  @ffi.Uint32()
-  external int socket_receive_buffer_size;
+  @ffi.Uint16()
+  external int event;
 
-  @ffi.Uint32()
-  external int socket_send_buffer_size;
+  @ffi.Int64()
+  external int timeout;
+}
 
-  @ffi.Uint32()
-  external int socket_receive_low_at;
+final class transport_streams extends ffi.Struct {
+  external ffi.Pointer<transport_stream> entries;
 
   @ffi.Uint32()
-  external int socket_send_low_at;
+  external int capacity;
+}
 
-  @ffi.Uint16()
-  external int ip_ttl;
+final class transport_timeout extends ffi.Struct {
+  @ffi.Uint64()
+  external int data;
 
-  @ffi.Uint32()
-  external int tcp_keep_alive_idle;
+  @ffi.Uint64()
+  external int deadline;
 
-  @ffi.Uint32()
-  external int tcp_keep_alive_max_count;
+  @ffi.Uint64()
+  external int timeout;
 
   @ffi.Uint32()
-  external int tcp_keep_alive_individual_count;
+  external int next;
 
   @ffi.Uint32()
-  external int tcp_max_segment_size;
-
-  @ffi.Uint16()
-  external int tcp_syn_count;
-
-  external ffi.Pointer<ip_mreqn> ip_multicast_interface;
+  external int previous;
 
   @ffi.Uint32()
-  external int ip_multicast_ttl;
+  external int slot;
 }
 
-final class transport_client extends ffi.Struct {
-  @ffi.Int()
-  external int fd;
+final class transport_timeouts extends ffi.Struct {
+  external ffi.Pointer<transport_timeout> entries;
 
-  external sockaddr_in inet_destination_address;
+  @ffi.Uint32()
+  external int capacity;
 
-  external sockaddr_in inet_source_address;
+  @ffi.Uint32()
+  external int free;
 
-  external sockaddr_un unix_destination_address;
+  @ffi.Uint32()
+  external int count;
 
-  external sockaddr_un unix_source_address;
+  @ffi.Uint32()
+  external int expired;
 
-  @socklen_t()
-  external int client_address_length;
+  @ffi.Uint64()
+  external int current;
 
-  @ffi.Int32()
-  external int family;
+  @ffi.Array.multi([256])
+  external ffi.Array<ffi.Uint32> slots;
 }
 
-typedef transport_client_t = transport_client;
-typedef transport_client_configuration_t = transport_client_configuration;
-
-final class mh_events_node_t extends ffi.Struct {
+final class transport_fd_event extends ffi.Struct {
   @ffi.Uint64()
   external int data;
 
-  @ffi.Int64()
-  external int timeout;
+  @ffi.Uint32()
+  external int next;
 
-  @ffi.Uint64()
-  external int timestamp;
+  @ffi.Uint32()
+  external int previous;
 
   @ffi.Int()
   external int fd;
 }
 
-final class mh_events_t extends ffi.Struct {
-  external ffi.Pointer<mh_events_node_t> p;
+final class transport_fd_events extends ffi.Struct {
+  external ffi.Pointer<transport_fd_event> entries;
 
-  external ffi.Pointer<ffi.Uint32> b;
+  @ffi.Uint32()
+  external int capacity;
 
-  @mh_int_t()
-  external int n_buckets;
+  @ffi.Uint32()
+  external int free;
 
-  @mh_int_t()
-  external int n_dirty;
+  external ffi.Pointer<ffi.Uint32> heads;
 
-  @mh_int_t()
-  external int size;
+  @ffi.Uint32()
+  external int heads_capacity;
+}
 
-  @mh_int_t()
-  external int upper_bound;
+final class transport_queue extends ffi.Struct {
+  external ffi.Pointer<ffi.Uint8> elements;
 
-  @mh_int_t()
-  external int prime;
+  @ffi.Uint32()
+  external int element_size;
 
-  @mh_int_t()
-  external int resize_cnt;
+  @ffi.Uint32()
+  external int mask;
 
-  @mh_int_t()
-  external int resize_position;
+  @ffi.Array.multi([64])
+  external ffi.Array<ffi.Uint8> head_padding;
 
-  @mh_int_t()
-  external int batch;
+  @ffi.Uint32()
+  external int head;
 
-  external ffi.Pointer<mh_events_t> shadow;
-}
+  @ffi.Array.multi([60])
+  external ffi.Array<ffi.Uint8> tail_padding;
 
-typedef mh_int_t = ffi.Uint32;
+  @ffi.Uint32()
+  external int tail;
 
-final class transport_server_configuration extends ffi.Struct {
-  @ffi.Int32()
-  external int socket_max_connections;
+  @ffi.Array.multi([60])
+  external ffi.Array<ffi.Uint8> end_padding;
+}
 
-  @ffi.Uint64()
-  external int socket_configuration_flags;
+final class transport_backlog extends ffi.Struct {
+  external ffi.Pointer<ffi.Uint8> elements;
 
   @ffi.Uint32()
-  external int socket_receive_buffer_size;
+  external int element_size;
 
   @ffi.Uint32()
-  external int socket_send_buffer_size;
+  external int capacity;
 
   @ffi.Uint32()
-  external int socket_receive_low_at;
+  external int head;
 
   @ffi.Uint32()
-  external int socket_send_low_at;
-
-  @ffi.Uint16()
-  external int ip_ttl;
+  external int count;
+}
 
+final class transport_worker_configuration extends ffi.Struct {
   @ffi.Uint32()
-  external int tcp_keep_alive_idle;
+  external int buffers_count;
 
-  @ffi.Uint32()
-  external int tcp_keep_alive_max_count;
+  @ffi.Uint16()
+  external int provided_buffers_count;
 
   @ffi.Uint32()
-  external int tcp_keep_alive_individual_count;
+  external int buffer_size;
 
-  @ffi.Uint32()
-  external int tcp_max_segment_size;
+  @ffi.Array.multi([8])
+  external ffi.Array<ffi.Uint32> buffer_class_sizes;
 
-  @ffi.Uint16()
-  external int tcp_syn_count;
+  @ffi.Array.multi([8])
+  external ffi.Array<ffi.Uint32> buffer_class_counts;
 
-  external ffi.Pointer<ip_mreqn> ip_multicast_interface;
+  @ffi.Uint8()
+  external int buffer_classes_count;
 
   @ffi.Uint32()
-  external int ip_multicast_ttl;
-}
+  external int max_buffers_count;
 
-final class transport_server extends ffi.Struct {
-  @ffi.Int()
-  external int fd;
+  @ffi.Uint32()
+  external int buffers_grow_chunk;
 
-  @ffi.Int32()
-  external int family;
+  @ffi.Uint64()
+  external int buffers_shrink_idle_millis;
 
-  external sockaddr_in inet_server_address;
+  @ffi.Bool()
+  external bool huge_pages;
 
-  external sockaddr_un unix_server_address;
+  @ffi.Bool()
+  external bool zero_buffers;
 
-  @socklen_t()
-  external int server_address_length;
-}
+  @ffi.Uint32()
+  external int registered_files_count;
 
-typedef transport_server_t = transport_server;
-typedef transport_server_configuration_t = transport_server_configuration;
+  @ffi.Uint32()
+  external int splice_pipes_count;
 
-final class transport_worker_configuration extends ffi.Struct {
-  @ffi.Uint16()
-  external int buffers_count;
+  @ffi.Bool()
+  external bool link_timeouts;
 
-  @ffi.Uint32()
-  external int buffer_size;
+  @ffi.Bool()
+  external bool eventfd_wakeups;
+
+  @ffi.Bool()
+  external bool io_thread;
+
+  @ffi.Int32()
+  external int io_thread_cpu;
 
   @ffi.Size()
   external int ring_size;
@@ -13334,6 +14039,9 @@ final class transport_worker_configuration extends ffi.Struct {
   @ffi.UnsignedInt()
   external int ring_flags;
 
+  @ffi.Double()
+  external double submit_fill_factor;
+
   @ffi.Uint64()
   external int timeout_checker_period_millis;
 
@@ -13355,6 +14063,9 @@ final class transport_worker_configuration extends ffi.Struct {
   @ffi.Uint32()
   external int cqe_peek_count;
 
+  @ffi.Bool()
+  external bool wide_tags;
+
   @ffi.Bool()
   external bool trace;
 }
@@ -13363,18 +14074,76 @@ final class transport_worker extends ffi.Struct {
   @ffi.Uint8()
   external int id;
 
-  external transport_buffers_pool free_buffers;
+  external ffi.Pointer<transport_buffers_class> buffer_classes;
+
+  @ffi.Uint8()
+  external int buffer_classes_count;
 
   external ffi.Pointer<io_uring> ring;
 
   external ffi.Pointer<iovec> buffers;
 
+  external ffi.Pointer<ffi.Void> buffers_arena;
+
+  @ffi.Size()
+  external int buffers_arena_size;
+
+  @ffi.Bool()
+  external bool zero_buffers;
+
+  @ffi.Bool()
+  external bool huge_pages;
+
   @ffi.Uint32()
   external int buffer_size;
 
-  @ffi.Uint16()
+  @ffi.Uint32()
   external int buffers_count;
 
+  @ffi.Uint32()
+  external int static_buffers_count;
+
+  @ffi.Uint32()
+  external int buffers_capacity;
+
+  @ffi.Uint32()
+  external int registered_buffers_count;
+
+  @ffi.Uint32()
+  external int buffers_grow_chunk;
+
+  @ffi.Uint64()
+  external int buffers_shrink_idle_millis;
+
+  @ffi.Uint64()
+  external int buffers_pressure_time;
+
+  external ffi.Pointer<transport_buffers_chunk> buffers_chunks;
+
+  @ffi.Uint32()
+  external int buffers_chunks_count;
+
+  @ffi.Uint64()
+  external int buffers_grows;
+
+  @ffi.Uint64()
+  external int buffers_shrinks;
+
+  @ffi.Uint16()
+  external int provided_buffers_count;
+
+  external ffi.Pointer<io_uring_buf_ring> provided_buffers;
+
+  @ffi.Uint32()
+  external int registered_files_count;
+
+  external ffi.Pointer<ffi.Bool> registered_files;
+
+  @ffi.Bool()
+  external bool link_timeouts;
+
+  external ffi.Pointer<__kernel_timespec> link_timeout_specs;
+
   @ffi.Uint64()
   external int timeout_checker_period_millis;
 
@@ -13391,7 +14160,34 @@ final class transport_worker extends ffi.Struct {
 
   external ffi.Pointer<msghdr> unix_used_messages;
 
-  external ffi.Pointer<mh_events_t> events;
+  external ffi.Pointer<sockaddr_in> inet_used_addresses;
+
+  external ffi.Pointer<sockaddr_un> unix_used_addresses;
+
+  external transport_events events;
+
+  @ffi.Bool()
+  external bool wide_tags;
+
+  external transport_tags tags;
+
+  external transport_vectors vectors;
+
+  external ffi.Pointer<ffi.Uint32> vector_buffer_ids;
+
+  external ffi.Pointer<ffi.Uint32> buffer_references;
+
+  external transport_framers framers;
+
+  external transport_backlog frames;
+
+  external transport_splices splices;
+
+  external transport_streams streams;
+
+  external transport_fd_events fd_events;
+
+  external transport_timeouts timeouts;
 
   @ffi.Size()
   external int ring_size;
@@ -13399,6 +14195,11 @@ final class transport_worker extends ffi.Struct {
   @ffi.Int()
   external int ring_flags;
 
+  @ffi.Uint32()
+  external int submit_threshold;
+
+  external transport_backlog backlog;
+
   external ffi.Pointer<ffi.Pointer<io_uring_cqe>> cqes;
 
   @ffi.Uint64()
@@ -13410,6 +14211,67 @@ final class transport_worker extends ffi.Struct {
   @ffi.Uint32()
   external int cqe_peek_count;
 
+  external ffi.Pointer<ffi.Uint32> completion_fds;
+
+  external ffi.Pointer<ffi.Uint32> completion_buffer_ids;
+
+  external ffi.Pointer<ffi.Uint16> completion_events;
+
+  external ffi.Pointer<ffi.Int32> completion_results;
+
+  external ffi.Pointer<ffi.Uint32> completion_flags;
+
+  @ffi.Bool()
+  external bool eventfd_wakeups;
+
+  @ffi.Bool()
+  external bool parked;
+
+  @ffi.Bool()
+  external bool chaining;
+
+  @ffi.Bool()
+  external bool timeouts_armed;
+
+  @ffi.Bool()
+  external bool wakeup_stopping;
+
+  @ffi.Int()
+  external int wakeup_fd;
+
+  @pthread_t()
+  external int wakeup_watcher;
+
+  external ffi.Pointer<ffi.NativeFunction<ffi.Void Function()>> wakeup_callback;
+
+  @ffi.Bool()
+  external bool io_thread;
+
+  @ffi.Int32()
+  external int io_thread_cpu;
+
+  @ffi.Bool()
+  external bool io_thread_running;
+
+  @ffi.Bool()
+  external bool io_thread_sleeping;
+
+  @ffi.Bool()
+  external bool io_thread_stopping;
+
+  @ffi.Int()
+  external int io_thread_wakeup_fd;
+
+  @ffi.Uint64()
+  external int io_thread_wakeup_value;
+
+  @pthread_t()
+  external int io_thread_handle;
+
+  external transport_queue submissions;
+
+  external transport_queue completions;
+
   @ffi.Bool()
   external bool trace;
 }
@@ -17885,6 +18747,30 @@ const int TRANSPORT_EVENT_FILE = 128;
 
 const int TRANSPORT_EVENT_SERVER = 256;
 
+const int TRANSPORT_EVENT_READ_MULTISHOT = 512;
+
+const int TRANSPORT_EVENT_LINK_TIMEOUT = 1024;
+
+const int TRANSPORT_EVENT_WAKEUP = 2048;
+
+const int TRANSPORT_EVENT_VECTOR = 4096;
+
+const int TRANSPORT_EVENT_FRAME = 8192;
+
+const int TRANSPORT_EVENT_SPLICE = 16384;
+
+const int TRANSPORT_EVENT_SPLICE_INPUT = 32768;
+
+const int TRANSPORT_EVENT_SPLICE_POLL = 1024;
+
+const int TRANSPORT_EVENT_TIMEOUTS_TICK = 3072;
+
+const int TRANSPORT_FRAMING_NONE = 0;
+
+const int TRANSPORT_FRAMING_LENGTH = 1;
+
+const int TRANSPORT_FRAMING_DELIMITER = 2;
+
 const int TRANSPORT_READ_ONLY = 1;
 
 const int TRANSPORT_WRITE_ONLY = 2;
@@ -17897,8 +18783,14 @@ const int TRANSPORT_READ_WRITE_APPEND = 16;
 
 const int TRANSPORT_BUFFER_USED = -1;
 
+const int TRANSPORT_BUFFER_CLASSES_MAX = 8;
+
+const int TRANSPORT_REGISTERED_BUFFERS_MAX = 16384;
+
 const int TRANSPORT_TIMEOUT_INFINITY = -1;
 
+const int TRANSPORT_PROVIDED_BUFFERS_GROUP = 0;
+
 const int TRANSPORT_SOCKET_OPTION_SOCKET_NONBLOCK = 2;
 
 const int TRANSPORT_SOCKET_OPTION_SOCKET_CLOCEXEC = 4;
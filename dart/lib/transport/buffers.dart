@@ -1,29 +1,233 @@
 import 'dart:async';
 import 'dart:collection';
 import 'dart:ffi';
+import 'dart:math';
 import 'dart:typed_data';
 
 import 'bindings.dart';
 import 'constants.dart';
 
+class TransportBufferClassOccupancy {
+  final int size;
+  final int capacity;
+  final int used;
+
+  TransportBufferClassOccupancy(this.size, this.capacity, this.used);
+}
+
+class TransportBufferWaits {
+  final int depth;
+  final int count;
+  final Duration total;
+  final Duration max;
+
+  TransportBufferWaits(this.depth, this.count, this.total, this.max);
+
+  Duration get average => count == 0 ? Duration.zero : total ~/ count;
+}
+
+class TransportBufferQuota {
+  final Queue<_TransportBufferWaiter> _parked = Queue();
+  final int? limit;
+  final int reserved;
+
+  var _used = 0;
+  var _active = true;
+
+  TransportBufferQuota._(this.limit, this.reserved);
+
+  int get used => _used;
+  bool get active => _active;
+
+  @pragma(preferInlinePragma)
+  bool get _exhausted => _active && limit != null && _used >= limit!;
+
+  @pragma(preferInlinePragma)
+  int get _outstanding => _active && _used < reserved ? reserved - _used : 0;
+}
+
+class _TransportBufferWaiter {
+  final Completer<int> completer = Completer();
+  final int? size;
+  final TransportBufferQuota? quota;
+  final bool priority;
+  final int enqueued;
+
+  _TransportBufferWaiter(this.size, this.quota, this.priority, this.enqueued);
+}
+
+class _TransportBufferLanes {
+  final Queue<_TransportBufferWaiter> priority = Queue();
+  final Queue<_TransportBufferWaiter> reserved = Queue();
+  final Queue<_TransportBufferWaiter> normal = Queue();
+
+  @pragma(preferInlinePragma)
+  bool get isEmpty => priority.isEmpty && reserved.isEmpty && normal.isEmpty;
+}
+
 class TransportBuffers {
   final TransportBindings _bindings;
   final Pointer<iovec> buffers;
-  final Queue<Completer<void>> _finalizers = Queue();
+  final List<_TransportBufferLanes> _lanes = [];
+  final List<int> _classSizes = [];
+  final List<int> _classFirsts = [];
   final Pointer<transport_worker_t> _worker;
+  final _clock = Stopwatch()..start();
 
   late final int bufferSize;
+  late final int maxBufferSize;
   late final int buffersCount;
+  late final int providedBuffersCount;
+  late final int _staticBuffersCount;
+  late final Uint32List _vectorBufferIds;
+  late final List<List<int>?> _vectors;
+  late final List<TransportBufferQuota?> _owners;
+
+  var _releases = <Completer<void>>[];
+  var _waiting = 0;
+  var _reserved = 0;
+  var _waits = 0;
+  var _waitMicroseconds = 0;
+  var _maxWaitMicroseconds = 0;
 
   TransportBuffers(this._bindings, this.buffers, this._worker) {
     bufferSize = _worker.ref.buffer_size;
-    buffersCount = _worker.ref.buffers_count;
+    buffersCount = _worker.ref.buffers_capacity;
+    _staticBuffersCount = _worker.ref.static_buffers_count;
+    providedBuffersCount = _worker.ref.provided_buffers_count;
+    _vectorBufferIds = _worker.ref.vector_buffer_ids.asTypedList(buffersCount);
+    _vectors = List.filled(buffersCount, null);
+    _owners = List.filled(buffersCount, null);
+    for (var index = 0; index < _worker.ref.buffer_classes_count; index++) {
+      final bufferClass = _worker.ref.buffer_classes.elementAt(index).ref;
+      _classSizes.add(bufferClass.size);
+      _classFirsts.add(bufferClass.first);
+      _lanes.add(_TransportBufferLanes());
+    }
+    maxBufferSize = _classSizes.fold(bufferSize, max);
+  }
+
+  TransportBufferQuota quota({int? limit, int reserved = 0}) {
+    final quota = TransportBufferQuota._(limit, reserved);
+    _reserved += reserved;
+    return quota;
+  }
+
+  void dispose(TransportBufferQuota quota) {
+    if (!quota._active) return;
+    _reserved -= quota._outstanding;
+    quota._active = false;
+    while (quota._parked.isNotEmpty) _enqueue(quota._parked.removeFirst());
+    for (var bufferClass = 0; bufferClass < _lanes.length; bufferClass++) _serve(bufferClass);
+  }
+
+  @pragma(preferInlinePragma)
+  int _classOf(int bufferId) {
+    if (bufferId >= _staticBuffersCount) return 0;
+    var bufferClass = _classFirsts.length - 1;
+    while (bufferClass > 0 && bufferId < _classFirsts[bufferClass]) bufferClass--;
+    return bufferClass;
   }
 
   @pragma(preferInlinePragma)
   void release(int bufferId) {
+    final vector = _vectors[bufferId];
+    if (vector != null) {
+      _vectors[bufferId] = null;
+      for (var index = 1; index < vector.length; index++) _release(vector[index]);
+    }
+    _release(bufferId);
+  }
+
+  @pragma(preferInlinePragma)
+  void _release(int bufferId) {
     _bindings.transport_worker_release_buffer(_worker, bufferId);
-    if (_finalizers.isNotEmpty) _finalizers.removeLast().complete();
+    final quota = _owners[bufferId];
+    if (quota != null) _discharge(bufferId, quota);
+    if (_releases.isNotEmpty) {
+      final releases = _releases;
+      _releases = [];
+      for (var release in releases) release.complete();
+    }
+    if (_waiting == 0) return;
+    if (_lanes.length == 1) {
+      _serve(0);
+      return;
+    }
+    final releasedSize = _classSizes[_classOf(bufferId)];
+    for (var bufferClass = 0; bufferClass < _lanes.length; bufferClass++) {
+      if (_classSizes[bufferClass] <= releasedSize) _serve(bufferClass);
+    }
+  }
+
+  @pragma(preferInlinePragma)
+  void _charge(int bufferId, TransportBufferQuota quota) {
+    if (quota._outstanding > 0) _reserved--;
+    quota._used++;
+    _owners[bufferId] = quota;
+  }
+
+  @pragma(preferInlinePragma)
+  void _discharge(int bufferId, TransportBufferQuota quota) {
+    _owners[bufferId] = null;
+    quota._used--;
+    if (quota._outstanding > 0) _reserved++;
+    if (quota._parked.isNotEmpty && !quota._exhausted) {
+      final waiter = quota._parked.removeFirst();
+      _enqueue(waiter);
+      _serve(_classFor(waiter.size));
+    }
+  }
+
+  @pragma(preferInlinePragma)
+  int _classFor(int? size) => size == null || _lanes.length == 1 ? 0 : _bindings.transport_worker_select_buffer_class(_worker, size);
+
+  @pragma(preferInlinePragma)
+  bool _admits(TransportBufferQuota? quota, bool priority) {
+    if (quota != null && quota._exhausted) return false;
+    if (_reserved == 0 || priority || (quota != null && quota._outstanding > 0)) return true;
+    return available() > _reserved || registered() < buffersCount;
+  }
+
+  void _enqueue(_TransportBufferWaiter waiter) {
+    final lanes = _lanes[_classFor(waiter.size)];
+    if (waiter.priority) {
+      lanes.priority.add(waiter);
+      return;
+    }
+    if (waiter.quota != null && waiter.quota!._outstanding > 0) {
+      lanes.reserved.add(waiter);
+      return;
+    }
+    lanes.normal.add(waiter);
+  }
+
+  void _serve(int bufferClass) {
+    final lanes = _lanes[bufferClass];
+    while (!lanes.isEmpty) {
+      final lane = lanes.priority.isNotEmpty
+          ? lanes.priority
+          : lanes.reserved.isNotEmpty
+              ? lanes.reserved
+              : lanes.normal;
+      final waiter = lane.first;
+      final quota = waiter.quota;
+      if (quota != null && quota._exhausted) {
+        quota._parked.add(lane.removeFirst());
+        continue;
+      }
+      if (!_admits(quota, waiter.priority)) return;
+      final bufferId = _take(waiter.size);
+      if (bufferId == transportBufferUsed) return;
+      lane.removeFirst();
+      if (quota != null) _charge(bufferId, quota);
+      final waited = _clock.elapsedMicroseconds - waiter.enqueued;
+      _waiting--;
+      _waits++;
+      _waitMicroseconds += waited;
+      if (waited > _maxWaitMicroseconds) _maxWaitMicroseconds = waited;
+      waiter.completer.complete(bufferId);
+    }
   }
 
   @pragma(preferInlinePragma)
@@ -44,31 +248,74 @@ class TransportBuffers {
   }
 
   @pragma(preferInlinePragma)
-  int? get() {
-    final buffer = _bindings.transport_worker_get_buffer(_worker);
+  void writeVector(List<int> bufferIds, List<Uint8List> bytes) {
+    for (var index = 0; index < bufferIds.length; index++) {
+      write(bufferIds[index], bytes[index]);
+      _vectorBufferIds[index] = bufferIds[index];
+    }
+    _vectors[bufferIds.first] = bufferIds;
+  }
+
+  @pragma(preferInlinePragma)
+  void gather(int bufferId, List<Uint8List> segments) {
+    final buffer = buffers.elementAt(bufferId);
+    final length = segments.fold(0, (length, segment) => length + segment.length);
+    final bufferBytes = buffer.ref.iov_base.cast<Uint8>().asTypedList(length);
+    var offset = 0;
+    for (var segment in segments) {
+      bufferBytes.setAll(offset, segment);
+      offset += segment.length;
+    }
+    buffer.ref.iov_len = length;
+  }
+
+  @pragma(preferInlinePragma)
+  void gatherVector(List<int> bufferIds, List<List<Uint8List>> chunks) {
+    for (var index = 0; index < bufferIds.length; index++) {
+      gather(bufferIds[index], chunks[index]);
+      _vectorBufferIds[index] = bufferIds[index];
+    }
+    _vectors[bufferIds.first] = bufferIds;
+  }
+
+  @pragma(preferInlinePragma)
+  int _take(int? size) => size == null || _lanes.length == 1 ? _bindings.transport_worker_get_buffer(_worker) : _bindings.transport_worker_get_buffer_sized(_worker, size);
+
+  @pragma(preferInlinePragma)
+  int? get({int? size, TransportBufferQuota? quota, bool priority = false}) {
+    if (_waiting > 0 && !priority && !_lanes[_classFor(size)].isEmpty) return null;
+    if ((quota != null || _reserved > 0) && !_admits(quota, priority)) return null;
+    final buffer = _take(size);
     if (buffer == transportBufferUsed) return null;
+    if (quota != null) _charge(buffer, quota);
     return buffer;
   }
 
-  Future<int> allocate() async {
-    var bufferId = _bindings.transport_worker_get_buffer(_worker);
-    while (bufferId == transportBufferUsed) {
-      if (_finalizers.isNotEmpty) {
-        await _finalizers.last.future;
-        bufferId = _bindings.transport_worker_get_buffer(_worker);
-        continue;
-      }
-      final completer = Completer();
-      _finalizers.add(completer);
-      await completer.future;
-      bufferId = _bindings.transport_worker_get_buffer(_worker);
+  Future<int> allocate({int? size, TransportBufferQuota? quota, bool priority = false}) {
+    final bufferId = get(size: size, quota: quota, priority: priority);
+    if (bufferId != null) return Future.value(bufferId);
+    final waiter = _TransportBufferWaiter(size, quota, priority, _clock.elapsedMicroseconds);
+    _waiting++;
+    if (quota != null && quota._exhausted) {
+      quota._parked.add(waiter);
+      return waiter.completer.future;
     }
-    return bufferId;
+    _enqueue(waiter);
+    return waiter.completer.future;
+  }
+
+  Future<void> released() {
+    final completer = Completer<void>();
+    _releases.add(completer);
+    return completer.future;
   }
 
-  Future<List<int>> allocateArray(int count) async {
+  Future<List<int>> allocateArray(int count, {List<int>? sizes, TransportBufferQuota? quota, bool priority = false}) async {
     final bufferIds = <int>[];
-    for (var index = 0; index < count; index++) bufferIds.add(get() ?? await allocate());
+    for (var index = 0; index < count; index++) {
+      final size = sizes?[index];
+      bufferIds.add(get(size: size, quota: quota, priority: priority) ?? await allocate(size: size, quota: quota, priority: priority));
+    }
     return bufferIds;
   }
 
@@ -78,6 +325,34 @@ class TransportBuffers {
   @pragma(preferInlinePragma)
   int used() => _bindings.transport_worker_used_buffers(_worker);
 
+  @pragma(preferInlinePragma)
+  int registered() => _worker.ref.buffers_count;
+
+  @pragma(preferInlinePragma)
+  int grows() => _worker.ref.buffers_grows;
+
+  @pragma(preferInlinePragma)
+  int shrinks() => _worker.ref.buffers_shrinks;
+
+  @pragma(preferInlinePragma)
+  int waiting() => _waiting;
+
+  TransportBufferWaits waits() => TransportBufferWaits(
+        _waiting,
+        _waits,
+        Duration(microseconds: _waitMicroseconds),
+        Duration(microseconds: _maxWaitMicroseconds),
+      );
+
+  List<TransportBufferClassOccupancy> occupancy() => List.generate(
+        _classSizes.length,
+        (bufferClass) => TransportBufferClassOccupancy(
+          _classSizes[bufferClass],
+          _worker.ref.buffer_classes.elementAt(bufferClass).ref.count + (bufferClass == 0 ? _worker.ref.buffers_count - _staticBuffersCount : 0),
+          _bindings.transport_worker_used_class_buffers(_worker, bufferClass),
+        ),
+      );
+
   @pragma(preferInlinePragma)
   void releaseArray(List<int> buffers) {
     for (var id in buffers) release(id);
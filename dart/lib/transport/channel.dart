@@ -3,6 +3,8 @@ import 'dart:typed_data';
 
 import 'bindings.dart';
 import 'buffers.dart';
+import 'coalescer.dart';
+import 'configuration.dart';
 import 'constants.dart';
 
 class TransportChannel {
@@ -10,8 +12,24 @@ class TransportChannel {
   final Pointer<transport_worker_t> _workerPointer;
   final TransportBindings _bindings;
   final TransportBuffers _buffers;
+  final int? _zeroCopySendThreshold;
+  final TransportFraming? framing;
+  final TransportWriteCoalescer? coalescer;
+  final TransportBufferQuota? quota;
 
-  const TransportChannel(this._workerPointer, this.fd, this._bindings, this._buffers);
+  TransportChannel(
+    this._workerPointer,
+    this.fd,
+    this._bindings,
+    this._buffers, {
+    int? zeroCopySendThreshold,
+    this.framing,
+    int? coalesceThreshold,
+    int? bufferQuota,
+    int? bufferReservation,
+  })  : _zeroCopySendThreshold = zeroCopySendThreshold,
+        coalescer = coalesceThreshold == null ? null : TransportWriteCoalescer(coalesceThreshold),
+        quota = bufferQuota == null && bufferReservation == null ? null : _buffers.quota(limit: bufferQuota, reserved: bufferReservation ?? 0);
 
   @pragma(preferInlinePragma)
   void read(
@@ -32,6 +50,54 @@ class TransportChannel {
     );
   }
 
+  @pragma(preferInlinePragma)
+  void readMultishot(
+    int event, {
+    int sqeFlags = 0,
+    int? timeout,
+  }) {
+    _bindings.transport_worker_read_multishot(
+      _workerPointer,
+      fd,
+      timeout ?? transportTimeoutInfinity,
+      event,
+      sqeFlags,
+    );
+  }
+
+  @pragma(preferInlinePragma)
+  int readStream(
+    int bufferId,
+    int event, {
+    int? timeout,
+  }) =>
+      _bindings.transport_worker_read_stream(
+        _workerPointer,
+        fd,
+        bufferId,
+        timeout ?? transportTimeoutInfinity,
+        event,
+      );
+
+  @pragma(preferInlinePragma)
+  void clearStream() => _bindings.transport_worker_clear_stream(_workerPointer, fd);
+
+  @pragma(preferInlinePragma)
+  int readFramed(
+    int event, {
+    int? timeout,
+  }) =>
+      _bindings.transport_worker_read_framed(
+        _workerPointer,
+        fd,
+        framing!.mode,
+        framing!.lengthSize,
+        framing!.delimiter,
+        framing!.maxFrameSize,
+        timeout ?? transportTimeoutInfinity,
+        event,
+      );
+
   @pragma(preferInlinePragma)
   void write(
     Uint8List bytes,
@@ -42,6 +108,29 @@ class TransportChannel {
     int? timeout,
   }) {
     _buffers.write(bufferId, bytes);
+    writeBuffer(bufferId, bytes.length, event, sqeFlags: sqeFlags, offset: offset, timeout: timeout);
+  }
+
+  @pragma(preferInlinePragma)
+  void writeBuffer(
+    int bufferId,
+    int length,
+    int event, {
+    int sqeFlags = 0,
+    int offset = 0,
+    int? timeout,
+  }) {
+    if (_zeroCopySendThreshold != null && length >= _zeroCopySendThreshold!) {
+      _bindings.transport_worker_send_zero_copy(
+        _workerPointer,
+        fd,
+        bufferId,
+        timeout ?? transportTimeoutInfinity,
+        event,
+        sqeFlags,
+      );
+      return;
+    }
     _bindings.transport_worker_write(
       _workerPointer,
       fd,
@@ -53,6 +142,79 @@ class TransportChannel {
     );
   }
 
+  @pragma(preferInlinePragma)
+  int writeVector(
+    List<Uint8List> bytes,
+    List<int> bufferIds,
+    int event, {
+    int sqeFlags = 0,
+    int offset = 0,
+    int? timeout,
+  }) {
+    _buffers.writeVector(bufferIds, bytes);
+    return _bindings.transport_worker_write_vector(
+      _workerPointer,
+      fd,
+      bufferIds.length,
+      offset,
+      timeout ?? transportTimeoutInfinity,
+      event,
+      sqeFlags,
+    );
+  }
+
+  @pragma(preferInlinePragma)
+  int writeBatch(
+    TransportWriteBatch batch,
+    List<int> bufferIds,
+    int event, {
+    int? timeout,
+  }) {
+    if (bufferIds.length == 1) {
+      _buffers.gather(bufferIds.first, batch.chunks.first);
+      _bindings.transport_worker_write(
+        _workerPointer,
+        fd,
+        bufferIds.first,
+        0,
+        timeout ?? transportTimeoutInfinity,
+        event,
+        0,
+      );
+      return 0;
+    }
+    _buffers.gatherVector(bufferIds, batch.chunks);
+    return _bindings.transport_worker_write_vector(
+      _workerPointer,
+      fd,
+      bufferIds.length,
+      0,
+      timeout ?? transportTimeoutInfinity,
+      event,
+      0,
+    );
+  }
+
+  @pragma(preferInlinePragma)
+  int sendFile(
+    int sourceFd,
+    int offset,
+    int length,
+    int event, {
+    int chunkSize = transportSpliceChunkSize,
+    int? timeout,
+  }) =>
+      _bindings.transport_worker_send_file(
+        _workerPointer,
+        fd,
+        sourceFd,
+        offset,
+        length,
+        chunkSize,
+        timeout ?? transportTimeoutInfinity,
+        event,
+      );
+
   @pragma(preferInlinePragma)
   void receiveMessage(
     int bufferId,
@@ -86,6 +248,20 @@ class TransportChannel {
     int sqeFlags = 0,
   }) {
     _buffers.write(bufferId, bytes);
+    if (_zeroCopySendThreshold != null && bytes.length >= _zeroCopySendThreshold!) {
+      _bindings.transport_worker_send_message_zero_copy(
+        _workerPointer,
+        fd,
+        bufferId,
+        destination,
+        socketFamily,
+        messageFlags,
+        timeout ?? transportTimeoutInfinity,
+        event,
+        sqeFlags,
+      );
+      return;
+    }
     _bindings.transport_worker_send_message(
       _workerPointer,
       fd,
@@ -100,5 +276,12 @@ class TransportChannel {
   }
 
   @pragma(preferInlinePragma)
-  void close() => _bindings.transport_close_descriptor(fd);
+  void close() {
+    if (framing != null) _bindings.transport_worker_clear_framing(_workerPointer, fd);
+    clearStream();
+    final quota = this.quota;
+    if (quota != null) _buffers.dispose(quota);
+    _bindings.transport_worker_unregister_file(_workerPointer, fd);
+    _bindings.transport_close_descriptor(fd);
+  }
 }
@@ -7,16 +7,23 @@ import 'package:meta/meta.dart';
 import '../bindings.dart';
 import '../buffers.dart';
 import '../channel.dart';
+import '../coalescer.dart';
 import '../constants.dart';
 import '../exception.dart';
+import '../lease.dart';
 import '../payload.dart';
 import 'provider.dart';
 import 'registry.dart';
 
 class TransportClientChannel {
   final _inboundEvents = StreamController<TransportPayload>();
+  StreamController<List<TransportPayload>>? _batches;
+  var _batch = <TransportPayload>[];
   final _outboundDoneHandlers = <int, void Function()>{};
   final _outboundErrorHandlers = <int, void Function(Exception error)>{};
+  final _spliceProgressHandlers = <int, void Function(int bytes)>{};
+  final _spliceDoneHandlers = <int, void Function()>{};
+  final _spliceErrorHandlers = <int, void Function(Exception error)>{};
   final Pointer<transport_client_t> _pointer;
   final Pointer<transport_worker_t> _workerPointer;
   final TransportChannel _channel;
@@ -34,9 +41,11 @@ class TransportClientChannel {
   var _pending = 0;
   var _active = true;
   var _closing = false;
+  var _reading = false;
   final _closer = Completer();
 
   bool get active => !_closing;
+  int get fd => _pointer.ref.fd;
   Stream<TransportPayload> get inbound => _inboundEvents.stream;
 
   TransportClientChannel(
@@ -55,14 +64,71 @@ class TransportClientChannel {
   }
 
   Future<void> read() async {
-    final bufferId = _buffers.get() ?? await _buffers.allocate();
+    if (_channel.framing != null) return _readFramed();
+    if (_buffers.providedBuffersCount > 0) return _readMultishot();
+    if (_batches != null) return _readStream();
+    final bufferId = _buffers.get(quota: _channel.quota) ?? await _buffers.allocate(quota: _channel.quota);
     if (_closing) return Future.error(TransportClosedException.forClient());
     _channel.read(bufferId, transportEventRead | transportEventClient, timeout: _readTimeout);
     _pending++;
   }
 
-  Future<void> writeSingle(Uint8List bytes, {void Function(Exception error)? onError, void Function()? onDone}) async {
-    final bufferId = _buffers.get() ?? await _buffers.allocate();
+  Stream<List<TransportPayload>> batches() {
+    final out = StreamController<List<TransportPayload>>(sync: true);
+    _batches = out;
+    out.onListen = () => unawaited(read().onError((error, stackTrace) => out.addError(error!)));
+    return out.stream;
+  }
+
+  @pragma(preferInlinePragma)
+  Future<void> _readStream() async {
+    if (_closing) return Future.error(TransportClosedException.forClient());
+    if (_reading) return;
+    _reading = true;
+    final bufferId = _buffers.get(quota: _channel.quota) ?? await _buffers.allocate(quota: _channel.quota);
+    if (_closing) {
+      _reading = false;
+      _buffers.release(bufferId);
+      return Future.error(TransportClosedException.forClient());
+    }
+    final result = _channel.readStream(bufferId, transportEventRead | transportEventClient, timeout: _readTimeout);
+    if (result < 0) {
+      _reading = false;
+      _buffers.release(bufferId);
+      return Future.error(createTransportException(TransportEvent.clientRead, result, _bindings));
+    }
+    _pending++;
+  }
+
+  @pragma(preferInlinePragma)
+  Future<void> _readMultishot() async {
+    if (_closing) return Future.error(TransportClosedException.forClient());
+    if (_reading) return;
+    _channel.readMultishot(transportEventReadMultishot | transportEventClient, timeout: _readTimeout);
+    _reading = true;
+    _pending++;
+  }
+
+  @pragma(preferInlinePragma)
+  Future<void> _readFramed() async {
+    if (_closing) return Future.error(TransportClosedException.forClient());
+    if (_reading) return;
+    final result = _channel.readFramed(transportEventReadMultishot | transportEventClient, timeout: _readTimeout);
+    if (result < 0) return Future.error(createTransportException(TransportEvent.clientRead, result, _bindings));
+    _reading = true;
+    _pending++;
+  }
+
+  Future<void> writeSingle(Uint8List bytes, {bool priority = false, void Function(Exception error)? onError, void Function()? onDone}) async {
+    final coalescer = _channel.coalescer;
+    if (coalescer != null) {
+      if (_closing) return Future.error(TransportClosedException.forClient());
+      if (coalescer.add(bytes, onError, onDone) || priority) return flush(priority: priority);
+      coalescer.schedule(() => unawaited(flush()));
+      return;
+    }
+    final bufferId = _buffers.get(size: bytes.length, quota: _channel.quota, priority: priority) ??
+        await _buffers.allocate(size: bytes.length, quota: _channel.quota, priority: priority);
     if (_closing) return Future.error(TransportClosedException.forClient());
     if (onError != null) _outboundErrorHandlers[bufferId] = onError;
     if (onDone != null) _outboundDoneHandlers[bufferId] = onDone;
@@ -70,9 +136,57 @@ class TransportClientChannel {
     _pending++;
   }
 
+  Future<TransportBufferLease> lease({int? size}) async {
+    final bufferId = _buffers.get(size: size, quota: _channel.quota) ?? await _buffers.allocate(size: size, quota: _channel.quota);
+    if (_closing) {
+      _buffers.release(bufferId);
+      return Future.error(TransportClosedException.forClient());
+    }
+    return TransportBufferLease(bufferId, _buffers.read(bufferId), _buffers);
+  }
+
+  Future<void> writeLease(TransportBufferLease lease, int length, {void Function(Exception error)? onError, void Function()? onDone}) async {
+    if (_channel.coalescer != null) await flush();
+    if (_closing) {
+      lease.release();
+      return Future.error(TransportClosedException.forClient());
+    }
+    _writeBuffer(lease.commit(length), length, onError, onDone);
+  }
+
+  Future<void> forward(TransportPayload payload, {void Function(Exception error)? onError, void Function()? onDone}) async {
+    if (_channel.coalescer != null) await flush();
+    if (_closing) {
+      payload.release();
+      return Future.error(TransportClosedException.forClient());
+    }
+    _writeBuffer(payload.bufferId, payload.bytes.length, onError, onDone);
+  }
+
+  @pragma(preferInlinePragma)
+  void _writeBuffer(int bufferId, int length, void Function(Exception error)? onError, void Function()? onDone) {
+    if (onError != null) _outboundErrorHandlers[bufferId] = onError;
+    if (onDone != null) _outboundDoneHandlers[bufferId] = onDone;
+    _channel.writeBuffer(bufferId, length, transportEventWrite | transportEventClient, timeout: _writeTimeout);
+    _pending++;
+  }
+
   Future<void> writeMany(List<Uint8List> bytes, {bool linked = true, void Function(Exception error)? onError, void Function()? onDone}) async {
-    final bufferIds = await _buffers.allocateArray(bytes.length);
+    if (_channel.coalescer != null) await flush();
+    final bufferIds = await _buffers.allocateArray(bytes.length, sizes: bytes.map((payload) => payload.length).toList(), quota: _channel.quota);
     if (_closing) return Future.error(TransportClosedException.forClient());
+    if (linked && bytes.length > 1) {
+      final bufferId = bufferIds.first;
+      final result = _channel.writeVector(bytes, bufferIds, transportEventWrite | transportEventClient, timeout: _writeTimeout);
+      if (result < 0) {
+        _buffers.release(bufferId);
+        return Future.error(createTransportException(TransportEvent.clientWrite, result, _bindings));
+      }
+      if (onError != null) _outboundErrorHandlers[bufferId] = onError;
+      if (onDone != null) _outboundDoneHandlers[bufferId] = onDone;
+      _pending++;
+      return;
+    }
     final lastBufferId = bufferIds.last;
     for (var index = 0; index < bytes.length - 1; index++) {
       final bufferId = bufferIds[index];
@@ -97,6 +211,57 @@ class TransportClientChannel {
     _pending += bytes.length;
   }
 
+  Future<void> sendFile(
+    int sourceFd,
+    int offset,
+    int length, {
+    int chunkSize = transportSpliceChunkSize,
+    void Function(int bytes)? onProgress,
+    void Function(Exception error)? onError,
+    void Function()? onDone,
+  }) async {
+    if (_channel.coalescer != null) await flush();
+    if (_closing) return Future.error(TransportClosedException.forClient());
+    final spliceId = _channel.sendFile(sourceFd, offset, length, transportEventSplice | transportEventClient, chunkSize: chunkSize, timeout: _writeTimeout);
+    if (spliceId < 0) return Future.error(createTransportException(TransportEvent.clientSplice, spliceId, _bindings));
+    if (onProgress != null) _spliceProgressHandlers[spliceId] = onProgress;
+    if (onError != null) _spliceErrorHandlers[spliceId] = onError;
+    if (onDone != null) _spliceDoneHandlers[spliceId] = onDone;
+    _pending++;
+  }
+
+  Future<void> flush({bool priority = false}) {
+    final coalescer = _channel.coalescer;
+    if (coalescer == null || coalescer.isEmpty) return Future.value();
+    final batch = coalescer.take(_buffers.maxBufferSize);
+    return coalescer.chain(() => _writeBatch(batch, priority));
+  }
+
+  Future<void> _writeBatch(TransportWriteBatch batch, bool priority) async {
+    if (batch.chunks.isEmpty) {
+      batch.onDone?.call();
+      return;
+    }
+    final bufferIds = await _buffers.allocateArray(batch.chunks.length, sizes: batch.sizes, quota: _channel.quota, priority: priority);
+    if (_closing) {
+      _buffers.releaseArray(bufferIds);
+      batch.onError?.call(TransportClosedException.forClient());
+      return;
+    }
+    final bufferId = bufferIds.first;
+    final result = _channel.writeBatch(batch, bufferIds, transportEventWrite | transportEventClient, timeout: _writeTimeout);
+    if (result < 0) {
+      _buffers.release(bufferId);
+      batch.onError?.call(createTransportException(TransportEvent.clientWrite, result, _bindings));
+      return;
+    }
+    final onError = batch.onError;
+    final onDone = batch.onDone;
+    if (onError != null) _outboundErrorHandlers[bufferId] = onError;
+    if (onDone != null) _outboundDoneHandlers[bufferId] = onDone;
+    _pending++;
+  }
+
   Future<void> receive({int? flags}) async {
     flags = flags ?? TransportDatagramMessageFlag.trunc.flag;
     final bufferId = _buffers.get() ?? await _buffers.allocate();
@@ -118,7 +283,7 @@ class TransportClientChannel {
     void Function()? onDone,
   }) async {
     flags = flags ?? TransportDatagramMessageFlag.trunc.flag;
-    final bufferId = _buffers.get() ?? await _buffers.allocate();
+    final bufferId = _buffers.get(size: bytes.length) ?? await _buffers.allocate(size: bytes.length);
     if (_closing) return Future.error(TransportClosedException.forClient());
     if (onError != null) _outboundErrorHandlers[bufferId] = onError;
     if (onDone != null) _outboundDoneHandlers[bufferId] = onDone;
@@ -142,7 +307,7 @@ class TransportClientChannel {
     void Function()? onDone,
   }) async {
     flags = flags ?? TransportDatagramMessageFlag.trunc.flag;
-    final bufferIds = await _buffers.allocateArray(bytes.length);
+    final bufferIds = await _buffers.allocateArray(bytes.length, sizes: bytes.map((payload) => payload.length).toList());
     if (_closing) return Future.error(TransportClosedException.forClient());
     final lastBufferId = bufferIds.last;
     for (var index = 0; index < bytes.length - 1; index++) {
@@ -210,8 +375,17 @@ class TransportClientChannel {
     _connector.completeError(TransportClosedException.forClient());
   }
 
-  void notifyData(int bufferId, int result, int event) {
-    _pending--;
+  void notifyData(int bufferId, int result, int event, int flags) {
+    if (event == transportEventReadMultishot) {
+      _notifyReadMultishot(bufferId, result, flags);
+      return;
+    }
+    if (event == transportEventSplice) {
+      _notifySplice(bufferId, result, flags);
+      return;
+    }
+    if (event == transportEventRead && flags & transportCqeFMore == 0) _reading = false;
+    if (flags & transportCqeFMore == 0) _pending--;
     if (_active) {
       if (_pending == 0 && _closing) {
         _active = false;
@@ -220,12 +394,12 @@ class TransportClientChannel {
       if (event == transportEventRead) {
         if (result > 0) {
           _buffers.setLength(bufferId, result);
-          _inboundEvents.add(_payloadPool.getPayload(bufferId, _buffers.read(bufferId)));
+          _deliver(_payloadPool.getPayload(bufferId, _buffers.read(bufferId)));
           return;
         }
         _buffers.release(bufferId);
         if (result < 0) {
-          _inboundEvents.addError(createTransportException(TransportEvent.clientEvent(event), result, _bindings));
+          _deliverError(createTransportException(TransportEvent.clientEvent(event), result, _bindings));
         }
         unawaited(close());
         return;
@@ -241,7 +415,11 @@ class TransportClientChannel {
         return;
       }
       if (event == transportEventWrite) {
-        _buffers.release(bufferId);
+        if (flags & transportCqeFNotif != 0) {
+          _buffers.release(bufferId);
+          return;
+        }
+        if (flags & transportCqeFMore == 0) _buffers.release(bufferId);
         if (result > 0) {
           _outboundDoneHandlers.remove(bufferId)?.call();
           return;
@@ -250,7 +428,11 @@ class TransportClientChannel {
         return;
       }
       if (event == transportEventSendMessage) {
-        _buffers.release(bufferId);
+        if (flags & transportCqeFNotif != 0) {
+          _buffers.release(bufferId);
+          return;
+        }
+        if (flags & transportCqeFMore == 0) _buffers.release(bufferId);
         if (result > 0) {
           _outboundDoneHandlers.remove(bufferId)?.call();
           return;
@@ -261,7 +443,88 @@ class TransportClientChannel {
       _buffers.release(bufferId);
       return;
     }
-    _buffers.release(bufferId);
+    if (event == transportEventRead || flags & transportCqeFMore == 0) _buffers.release(bufferId);
+    if (_pending == 0 && _closing && !_closer.isCompleted) _closer.complete();
+  }
+
+  @pragma(preferInlinePragma)
+  void _deliver(TransportPayload payload) {
+    if (_batches == null) {
+      _inboundEvents.add(payload);
+      return;
+    }
+    if (_batch.isEmpty) scheduleMicrotask(_flushBatch);
+    _batch.add(payload);
+  }
+
+  @pragma(preferInlinePragma)
+  void _deliverError(Exception error) {
+    if (_batches == null) {
+      _inboundEvents.addError(error);
+      return;
+    }
+    _flushBatch();
+    _batches!.addError(error);
+  }
+
+  void _flushBatch() {
+    if (_batch.isEmpty) return;
+    final batch = _batch;
+    _batch = [];
+    _batches!.add(batch);
+    if (!_reading && !(_closing)) unawaited(read().onError((error, stackTrace) => _batches!.addError(error!)));
+  }
+
+  void _notifyReadMultishot(int bufferId, int result, int flags) {
+    final selected = flags & transportCqeFBuffer != 0;
+    if (flags & transportCqeFMore == 0) {
+      _reading = false;
+      _pending--;
+    }
+    if (_active) {
+      if (_pending == 0 && _closing) {
+        _active = false;
+        _closer.complete();
+      }
+      if (result > 0 || result == 0 && selected && flags & transportCqeFMore != 0) {
+        _buffers.setLength(bufferId, result);
+        _deliver(_payloadPool.getPayload(bufferId, _buffers.read(bufferId)));
+        return;
+      }
+      if (selected) _buffers.release(bufferId);
+      if (result == -ENOBUFS) {
+        unawaited(_buffers.released().then((_) => _closing ? null : read()));
+        return;
+      }
+      if (result < 0) {
+        _deliverError(createTransportException(TransportEvent.clientEvent(transportEventReadMultishot), result, _bindings));
+      }
+      unawaited(close());
+      return;
+    }
+    if (selected) _buffers.release(bufferId);
+    if (_pending == 0 && _closing && !_closer.isCompleted) _closer.complete();
+  }
+
+  void _notifySplice(int spliceId, int result, int flags) {
+    if (result > 0) _spliceProgressHandlers[spliceId]?.call(result);
+    if (flags & transportCqeFMore != 0) return;
+    _pending--;
+    _spliceProgressHandlers.remove(spliceId);
+    final onDone = _spliceDoneHandlers.remove(spliceId);
+    final onError = _spliceErrorHandlers.remove(spliceId);
+    if (_active) {
+      if (_pending == 0 && _closing) {
+        _active = false;
+        _closer.complete();
+      }
+      if (result >= 0) {
+        onDone?.call();
+        return;
+      }
+      onError?.call(createTransportException(TransportEvent.clientSplice, result, _bindings));
+      return;
+    }
     if (_pending == 0 && _closing && !_closer.isCompleted) _closer.complete();
   }
 
@@ -272,7 +535,16 @@ class TransportClientChannel {
       }
       return;
     }
+    final coalescer = _channel.coalescer;
+    if (coalescer != null && !coalescer.isEmpty) {
+      if (gracefulTimeout != null) {
+        await flush();
+      } else {
+        coalescer.take(_buffers.maxBufferSize).onError?.call(TransportClosedException.forClient());
+      }
+    }
     _closing = true;
+    _channel.clearStream();
     if (_pending > 0) {
       if (gracefulTimeout == null) {
         _active = false;
@@ -292,6 +564,10 @@ class TransportClientChannel {
     }
     _active = false;
     if (_inboundEvents.hasListener) await _inboundEvents.close();
+    if (_batches != null) {
+      _flushBatch();
+      if (_batches!.hasListener) await _batches!.close();
+    }
     _channel.close();
     _registry.remove(_pointer.ref.fd);
     _bindings.transport_client_destroy(_pointer);
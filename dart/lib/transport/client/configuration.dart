@@ -25,6 +25,11 @@ class TransportTcpClientConfiguration {
   final int? tcpMaxSegmentSize;
   final bool? tcpNoDelay;
   final int? tcpSynCount;
+  final int? zeroCopySendThreshold;
+  final TransportFraming? framing;
+  final int? coalesceThreshold;
+  final int? bufferQuota;
+  final int? bufferReservation;
 
   TransportTcpClientConfiguration({
     required this.pool,
@@ -51,6 +56,11 @@ class TransportTcpClientConfiguration {
     this.tcpMaxSegmentSize,
     this.tcpNoDelay,
     this.tcpSynCount,
+    this.zeroCopySendThreshold,
+    this.framing,
+    this.coalesceThreshold,
+    this.bufferQuota,
+    this.bufferReservation,
   });
 
   TransportTcpClientConfiguration copyWith({
@@ -78,6 +88,11 @@ class TransportTcpClientConfiguration {
     int? tcpMaxSegmentSize,
     bool? tcpNoDelay,
     int? tcpSynCount,
+    int? zeroCopySendThreshold,
+    TransportFraming? framing,
+    int? coalesceThreshold,
+    int? bufferQuota,
+    int? bufferReservation,
   }) =>
       TransportTcpClientConfiguration(
         pool: pool ?? this.pool,
@@ -104,6 +119,11 @@ class TransportTcpClientConfiguration {
         tcpMaxSegmentSize: tcpMaxSegmentSize ?? this.tcpMaxSegmentSize,
         tcpNoDelay: tcpNoDelay ?? this.tcpNoDelay,
         tcpSynCount: tcpSynCount ?? this.tcpSynCount,
+        zeroCopySendThreshold: zeroCopySendThreshold ?? this.zeroCopySendThreshold,
+        framing: framing ?? this.framing,
+        coalesceThreshold: coalesceThreshold ?? this.coalesceThreshold,
+        bufferQuota: bufferQuota ?? this.bufferQuota,
+        bufferReservation: bufferReservation ?? this.bufferReservation,
       );
 }
 
@@ -126,6 +146,7 @@ class TransportUdpClientConfiguration {
   final int? ipMulticastLoop;
   final int? ipMulticastTtl;
   final TransportUdpMulticastManager? multicastManager;
+  final int? zeroCopySendThreshold;
 
   TransportUdpClientConfiguration({
     this.readTimeout,
@@ -146,6 +167,7 @@ class TransportUdpClientConfiguration {
     this.ipMulticastLoop,
     this.ipMulticastTtl,
     this.multicastManager,
+    this.zeroCopySendThreshold,
   });
 
   TransportUdpClientConfiguration copyWith({
@@ -167,6 +189,7 @@ class TransportUdpClientConfiguration {
     int? ipMulticastLoop,
     int? ipMulticastTtl,
     TransportUdpMulticastManager? multicastManager,
+    int? zeroCopySendThreshold,
   }) =>
       TransportUdpClientConfiguration(
         readTimeout: readTimeout ?? this.readTimeout,
@@ -187,6 +210,7 @@ class TransportUdpClientConfiguration {
         ipMulticastLoop: ipMulticastLoop ?? this.ipMulticastLoop,
         ipMulticastTtl: ipMulticastTtl ?? this.ipMulticastTtl,
         multicastManager: multicastManager ?? this.multicastManager,
+        zeroCopySendThreshold: zeroCopySendThreshold ?? this.zeroCopySendThreshold,
       );
 }
 
@@ -202,6 +226,10 @@ class TransportUnixStreamClientConfiguration {
   final bool? socketKeepalive;
   final int? socketReceiveLowAt;
   final int? socketSendLowAt;
+  final TransportFraming? framing;
+  final int? coalesceThreshold;
+  final int? bufferQuota;
+  final int? bufferReservation;
 
   TransportUnixStreamClientConfiguration({
     required this.pool,
@@ -215,6 +243,10 @@ class TransportUnixStreamClientConfiguration {
     this.socketKeepalive,
     this.socketReceiveLowAt,
     this.socketSendLowAt,
+    this.framing,
+    this.coalesceThreshold,
+    this.bufferQuota,
+    this.bufferReservation,
   });
 
   TransportUnixStreamClientConfiguration copyWith({
@@ -228,6 +260,10 @@ class TransportUnixStreamClientConfiguration {
     bool? socketCloexec,
     int? socketReceiveLowAt,
     int? socketSendLowAt,
+    TransportFraming? framing,
+    int? coalesceThreshold,
+    int? bufferQuota,
+    int? bufferReservation,
   }) =>
       TransportUnixStreamClientConfiguration(
         pool: pool ?? this.pool,
@@ -241,5 +277,9 @@ class TransportUnixStreamClientConfiguration {
         socketKeepalive: socketKeepalive ?? this.socketKeepalive,
         socketReceiveLowAt: socketReceiveLowAt ?? this.socketReceiveLowAt,
         socketSendLowAt: socketSendLowAt ?? this.socketSendLowAt,
+        framing: framing ?? this.framing,
+        coalesceThreshold: coalesceThreshold ?? this.coalesceThreshold,
+        bufferQuota: bufferQuota ?? this.bufferQuota,
+        bufferReservation: bufferReservation ?? this.bufferReservation,
       );
 }
@@ -63,17 +63,23 @@ class TransportClientsFactory {
           clientPointer.ref.fd,
           _bindings,
           _buffers,
+          zeroCopySendThreshold: configuration.zeroCopySendThreshold,
+          framing: configuration.framing,
+          coalesceThreshold: configuration.coalesceThreshold,
+          bufferQuota: configuration.bufferQuota,
+          bufferReservation: configuration.bufferReservation,
         ),
         clientPointer,
         _workerPointer,
         _bindings,
-        configuration.readTimeout?.inSeconds,
-        configuration.writeTimeout?.inSeconds,
+        configuration.readTimeout?.inMilliseconds,
+        configuration.writeTimeout?.inMilliseconds,
         _buffers,
         _registry,
         _payloadPool,
-        connectTimeout: configuration.connectTimeout?.inSeconds,
+        connectTimeout: configuration.connectTimeout?.inMilliseconds,
       );
+      _bindings.transport_worker_register_file(_workerPointer, clientPointer.ref.fd);
       _registry.add(clientPointer.ref.fd, client);
       clients.add(client.connect().then(TransportClientConnection.new));
     }
@@ -154,16 +160,18 @@ class TransportClientsFactory {
         clientPointer.ref.fd,
         _bindings,
         _buffers,
+        zeroCopySendThreshold: configuration.zeroCopySendThreshold,
       ),
       clientPointer,
       _workerPointer,
       _bindings,
-      configuration.readTimeout?.inSeconds,
-      configuration.writeTimeout?.inSeconds,
+      configuration.readTimeout?.inMilliseconds,
+      configuration.writeTimeout?.inMilliseconds,
       _buffers,
       _registry,
       _payloadPool,
     );
+    _bindings.transport_worker_register_file(_workerPointer, clientPointer.ref.fd);
     _registry.add(clientPointer.ref.fd, client);
     return TransportDatagramClient(client);
   }
@@ -200,19 +208,24 @@ class TransportClientsFactory {
         clientPointer.ref.fd,
         _bindings,
         _buffers,
+        framing: configuration.framing,
+        coalesceThreshold: configuration.coalesceThreshold,
+        bufferQuota: configuration.bufferQuota,
+        bufferReservation: configuration.bufferReservation,
       );
       final client = TransportClientChannel(
         channel,
         clientPointer,
         _workerPointer,
         _bindings,
-        configuration.readTimeout?.inSeconds,
-        configuration.writeTimeout?.inSeconds,
+        configuration.readTimeout?.inMilliseconds,
+        configuration.writeTimeout?.inMilliseconds,
         _buffers,
         _registry,
         _payloadPool,
-        connectTimeout: configuration.connectTimeout?.inSeconds,
+        connectTimeout: configuration.connectTimeout?.inMilliseconds,
       );
+      _bindings.transport_worker_register_file(_workerPointer, clientPointer.ref.fd);
       _registry.add(clientPointer.ref.fd, client);
       clients.add(client.connect().then(TransportClientConnection.new, onError: (error, stackTrace) {
         channel.close();
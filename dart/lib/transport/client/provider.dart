@@ -2,6 +2,8 @@ import 'dart:async';
 import 'dart:typed_data';
 
 import '../constants.dart';
+import '../file/provider.dart';
+import '../lease.dart';
 import '../payload.dart';
 import 'client.dart';
 
@@ -11,6 +13,7 @@ class TransportClientConnection {
   const TransportClientConnection(this._client);
 
   bool get active => _client.active;
+  int get fd => _client.fd;
   Stream<TransportPayload> get inbound => _client.inbound;
 
   Future<void> read() => _client.read();
@@ -31,21 +34,64 @@ class TransportClientConnection {
   }
 
   @pragma(preferInlinePragma)
-  void writeSingle(Uint8List bytes, {void Function(Exception error)? onError, void Function()? onDone}) {
-    unawaited(_client.writeSingle(bytes, onError: onError, onDone: onDone).onError((error, stackTrace) => onError?.call(error as Exception)));
+  Stream<List<TransportPayload>> batches() => _client.batches();
+
+  @pragma(preferInlinePragma)
+  void writeSingle(Uint8List bytes, {bool priority = false, void Function(Exception error)? onError, void Function()? onDone}) {
+    unawaited(_client.writeSingle(bytes, priority: priority, onError: onError, onDone: onDone).onError((error, stackTrace) => onError?.call(error as Exception)));
+  }
+
+  @pragma(preferInlinePragma)
+  Future<TransportBufferLease> lease({int? size}) => _client.lease(size: size);
+
+  @pragma(preferInlinePragma)
+  void writeLease(TransportBufferLease lease, int length, {void Function(Exception error)? onError, void Function()? onDone}) {
+    unawaited(_client.writeLease(lease, length, onError: onError, onDone: onDone).onError((error, stackTrace) => onError?.call(error as Exception)));
+  }
+
+  @pragma(preferInlinePragma)
+  void forward(TransportPayload payload, {void Function(Exception error)? onError, void Function()? onDone}) {
+    unawaited(_client.forward(payload, onError: onError, onDone: onDone).onError((error, stackTrace) => onError?.call(error as Exception)));
   }
 
   @pragma(preferInlinePragma)
   void writeMany(List<Uint8List> bytes, {linked = true, void Function(Exception error)? onError, void Function()? onDone}) {
+    final completions = linked ? 1 : bytes.length;
     var doneCounter = 0;
     var errorCounter = 0;
     unawaited(_client.writeMany(bytes, linked: linked, onError: (error) {
-      if (++errorCounter + doneCounter == bytes.length) onError?.call(error);
+      if (++errorCounter + doneCounter == completions) onError?.call(error);
     }, onDone: () {
-      if (errorCounter == 0 && ++doneCounter == bytes.length) onDone?.call();
+      if (errorCounter == 0 && ++doneCounter == completions) onDone?.call();
     }).onError((error, stackTrace) => onError?.call(error as Exception)));
   }
 
+  @pragma(preferInlinePragma)
+  Future<void> flush() => _client.flush();
+
+  @pragma(preferInlinePragma)
+  void sendFile(
+    TransportFile file, {
+    int offset = 0,
+    int? length,
+    int chunkSize = transportSpliceChunkSize,
+    void Function(int bytes)? onProgress,
+    void Function(Exception error)? onError,
+    void Function()? onDone,
+  }) {
+    unawaited(_client
+        .sendFile(
+          file.fd,
+          offset,
+          length ?? file.delegate.lengthSync() - offset,
+          chunkSize: chunkSize,
+          onProgress: onProgress,
+          onError: onError,
+          onDone: onDone,
+        )
+        .onError((error, stackTrace) => onError?.call(error as Exception)));
+  }
+
   @pragma(preferInlinePragma)
   Future<void> close({Duration? gracefulTimeout}) => _client.close(gracefulTimeout: gracefulTimeout);
 }
@@ -0,0 +1,97 @@
+import 'dart:async';
+import 'dart:math';
+import 'dart:typed_data';
+
+import 'constants.dart';
+
+class TransportWriteBatch {
+  final List<List<Uint8List>> chunks;
+  final List<int> sizes;
+  final List<void Function()> _doneHandlers;
+  final List<void Function(Exception error)> _errorHandlers;
+
+  TransportWriteBatch(this.chunks, this.sizes, this._doneHandlers, this._errorHandlers);
+
+  void Function()? get onDone => _doneHandlers.isEmpty ? null : _done;
+  void Function(Exception error)? get onError => _errorHandlers.isEmpty ? null : _error;
+
+  void _done() {
+    for (var handler in _doneHandlers) handler();
+  }
+
+  void _error(Exception error) {
+    for (var handler in _errorHandlers) handler(error);
+  }
+}
+
+class TransportWriteCoalescer {
+  final int threshold;
+
+  var _segments = <Uint8List>[];
+  var _doneHandlers = <void Function()>[];
+  var _errorHandlers = <void Function(Exception error)>[];
+  var _length = 0;
+  var _scheduled = false;
+  Future<void> _tail = Future.value();
+
+  bool get isEmpty => _segments.isEmpty;
+
+  TransportWriteCoalescer(this.threshold);
+
+  @pragma(preferInlinePragma)
+  bool add(Uint8List bytes, void Function(Exception error)? onError, void Function()? onDone) {
+    _segments.add(bytes);
+    if (onDone != null) _doneHandlers.add(onDone);
+    if (onError != null) _errorHandlers.add(onError);
+    _length += bytes.length;
+    return _length >= threshold;
+  }
+
+  @pragma(preferInlinePragma)
+  void schedule(void Function() flush) {
+    if (_scheduled) return;
+    _scheduled = true;
+    scheduleMicrotask(() {
+      _scheduled = false;
+      flush();
+    });
+  }
+
+  TransportWriteBatch take(int chunkSize) {
+    final chunks = <List<Uint8List>>[];
+    final sizes = <int>[];
+    var chunk = <Uint8List>[];
+    var size = 0;
+    for (var segment in _segments) {
+      var offset = 0;
+      while (offset < segment.length) {
+        if (size == chunkSize) {
+          chunks.add(chunk);
+          sizes.add(size);
+          chunk = <Uint8List>[];
+          size = 0;
+        }
+        final length = min(segment.length - offset, chunkSize - size);
+        chunk.add(offset == 0 && length == segment.length ? segment : Uint8List.sublistView(segment, offset, offset + length));
+        offset += length;
+        size += length;
+      }
+    }
+    if (size > 0) {
+      chunks.add(chunk);
+      sizes.add(size);
+    }
+    final batch = TransportWriteBatch(chunks, sizes, _doneHandlers, _errorHandlers);
+    _segments = [];
+    _doneHandlers = [];
+    _errorHandlers = [];
+    _length = 0;
+    return batch;
+  }
+
+  Future<void> chain(Future<void> Function() action) {
+    final next = _tail.then((_) => action());
+    _tail = next.catchError((_) {});
+    return next;
+  }
+}
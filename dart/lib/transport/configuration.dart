@@ -1,3 +1,5 @@
+import 'constants.dart';
+
 const ringSetupIopoll = 1 << 0;
 const ringSetupSqpoll = 1 << 1;
 const ringSetupSqAff = 1 << 2;
@@ -13,11 +15,54 @@ const ringSetupCqe32 = 1 << 11;
 const ringSetupSingleIssuer = 1 << 12;
 const ringSetupDeferTaskrun = 1 << 13;
 
+class TransportBufferClassConfiguration {
+  final int size;
+  final int count;
+
+  TransportBufferClassConfiguration({
+    required this.size,
+    required this.count,
+  });
+}
+
+class TransportFraming {
+  final int mode;
+  final int lengthSize;
+  final int delimiter;
+  final int maxFrameSize;
+
+  const TransportFraming.lengthPrefix({
+    this.lengthSize = 4,
+    required this.maxFrameSize,
+  })  : mode = transportFramingLength,
+        delimiter = 0;
+
+  const TransportFraming.delimiter({
+    this.delimiter = 0x0a,
+    required this.maxFrameSize,
+  })  : mode = transportFramingDelimiter,
+        lengthSize = 0;
+}
+
 class TransportWorkerConfiguration {
   final int buffersCount;
+  final int providedBuffersCount;
   final int bufferSize;
+  final List<TransportBufferClassConfiguration> bufferClasses;
+  final int? maxBuffersCount;
+  final int buffersGrowChunk;
+  final Duration buffersShrinkIdle;
+  final bool hugePages;
+  final bool zeroBuffers;
+  final int registeredFilesCount;
+  final int splicePipesCount;
+  final bool linkTimeouts;
+  final bool eventfdWakeups;
+  final bool ioThread;
+  final int? ioThreadCpu;
   final int ringSize;
   final int ringFlags;
+  final double submitFillFactor;
   final Duration timeoutCheckerPeriod;
   final double delayRandomizationFactor;
   final int cqePeekCount;
@@ -25,13 +70,28 @@ class TransportWorkerConfiguration {
   final Duration cqeWaitTimeout;
   final Duration baseDelay;
   final Duration maxDelay;
+  final bool wideTags;
   final bool trace;
 
   TransportWorkerConfiguration({
     required this.buffersCount,
+    required this.providedBuffersCount,
     required this.bufferSize,
+    required this.bufferClasses,
+    this.maxBuffersCount,
+    required this.buffersGrowChunk,
+    required this.buffersShrinkIdle,
+    required this.hugePages,
+    required this.zeroBuffers,
+    required this.registeredFilesCount,
+    required this.splicePipesCount,
+    required this.linkTimeouts,
+    required this.eventfdWakeups,
+    required this.ioThread,
+    this.ioThreadCpu,
     required this.ringSize,
     required this.ringFlags,
+    required this.submitFillFactor,
     required this.timeoutCheckerPeriod,
     required this.delayRandomizationFactor,
     required this.baseDelay,
@@ -39,14 +99,29 @@ class TransportWorkerConfiguration {
     required this.cqePeekCount,
     required this.cqeWaitCount,
     required this.cqeWaitTimeout,
+    required this.wideTags,
     required this.trace,
   });
 
   TransportWorkerConfiguration copyWith({
     int? buffersCount,
+    int? providedBuffersCount,
     int? bufferSize,
+    List<TransportBufferClassConfiguration>? bufferClasses,
+    int? maxBuffersCount,
+    int? buffersGrowChunk,
+    Duration? buffersShrinkIdle,
+    bool? hugePages,
+    bool? zeroBuffers,
+    int? registeredFilesCount,
+    int? splicePipesCount,
+    bool? linkTimeouts,
+    bool? eventfdWakeups,
+    bool? ioThread,
+    int? ioThreadCpu,
     int? ringSize,
     int? ringFlags,
+    double? submitFillFactor,
     Duration? timeoutCheckerPeriod,
     double? delayRandomizationFactor,
     Duration? baseDelay,
@@ -54,13 +129,28 @@ class TransportWorkerConfiguration {
     int? cqePeekCount,
     int? cqeWaitCount,
     Duration? cqeWaitTimeout,
+    bool? wideTags,
     bool? trace,
   }) =>
       TransportWorkerConfiguration(
         buffersCount: buffersCount ?? this.buffersCount,
+        providedBuffersCount: providedBuffersCount ?? this.providedBuffersCount,
         bufferSize: bufferSize ?? this.bufferSize,
+        bufferClasses: bufferClasses ?? this.bufferClasses,
+        maxBuffersCount: maxBuffersCount ?? this.maxBuffersCount,
+        buffersGrowChunk: buffersGrowChunk ?? this.buffersGrowChunk,
+        buffersShrinkIdle: buffersShrinkIdle ?? this.buffersShrinkIdle,
+        hugePages: hugePages ?? this.hugePages,
+        zeroBuffers: zeroBuffers ?? this.zeroBuffers,
+        registeredFilesCount: registeredFilesCount ?? this.registeredFilesCount,
+        splicePipesCount: splicePipesCount ?? this.splicePipesCount,
+        linkTimeouts: linkTimeouts ?? this.linkTimeouts,
+        eventfdWakeups: eventfdWakeups ?? this.eventfdWakeups,
+        ioThread: ioThread ?? this.ioThread,
+        ioThreadCpu: ioThreadCpu ?? this.ioThreadCpu,
         ringSize: ringSize ?? this.ringSize,
         ringFlags: ringFlags ?? this.ringFlags,
+        submitFillFactor: submitFillFactor ?? this.submitFillFactor,
         timeoutCheckerPeriod: timeoutCheckerPeriod ?? this.timeoutCheckerPeriod,
         delayRandomizationFactor: delayRandomizationFactor ?? this.delayRandomizationFactor,
         baseDelay: baseDelay ?? this.baseDelay,
@@ -68,6 +158,7 @@ class TransportWorkerConfiguration {
         cqePeekCount: cqePeekCount ?? this.cqePeekCount,
         cqeWaitCount: cqeWaitCount ?? this.cqeWaitCount,
         cqeWaitTimeout: cqeWaitTimeout ?? this.cqeWaitTimeout,
+        wideTags: wideTags ?? this.wideTags,
         trace: trace ?? this.trace,
       );
 }
@@ -49,6 +49,9 @@ class TransportPackageConfigFields {
 
 const transportBufferUsed = -1;
 
+const transportFramingLength = 1;
+const transportFramingDelimiter = 2;
+
 const transportEventRead = 1 << 0;
 const transportEventWrite = 1 << 1;
 const transportEventReceiveMessage = 1 << 2;
@@ -58,6 +61,9 @@ const transportEventConnect = 1 << 5;
 const transportEventClient = 1 << 6;
 const transportEventFile = 1 << 7;
 const transportEventServer = 1 << 8;
+const transportEventReadMultishot = 1 << 9;
+const transportEventLinkTimeout = 1 << 10;
+const transportEventSplice = 1 << 14;
 
 const transportEventAll = transportEventRead |
     transportEventWrite |
@@ -67,7 +73,8 @@ const transportEventAll = transportEventRead |
     transportEventSendMessage |
     transportEventClient |
     transportEventFile |
-    transportEventServer;
+    transportEventServer |
+    transportEventReadMultishot;
 
 const transportSocketOptionSocketNonblock = 1 << 1;
 const transportSocketOptionSocketCloexec = 1 << 2;
@@ -100,6 +107,7 @@ const transportSocketOptionTcpNoDelay = 1 << 28;
 const transportSocketOptionTcpSyncnt = 1 << 29;
 
 const transportTimeoutInfinity = -1;
+const transportSpliceChunkSize = 64 * 1024;
 const transportParentRingNone = -1;
 
 const transportIosqeFixedFile = 1 << 0;
@@ -110,6 +118,11 @@ const transportIosqeAsync = 1 << 4;
 const transportIosqeBufferSelect = 1 << 5;
 const transportIosqeCqeSkipSuccess = 1 << 6;
 
+const transportCqeFBuffer = 1 << 0;
+const transportCqeFMore = 1 << 1;
+const transportCqeFNotif = 1 << 3;
+const transportCqeBufferShift = 16;
+
 enum TransportDatagramMessageFlag {
   oob(0x01),
   peek(0x02),
@@ -152,14 +165,18 @@ enum TransportEvent {
   clientSend,
   fileRead,
   fileWrite,
+  serverSplice,
+  clientSplice,
+  proxy,
   unknown;
 
   static TransportEvent serverEvent(int event) {
-    if (event == transportEventRead) return TransportEvent.serverRead;
+    if (event == transportEventRead || event == transportEventReadMultishot) return TransportEvent.serverRead;
     if (event == transportEventWrite) return TransportEvent.serverWrite;
     if (event == transportEventSendMessage) return TransportEvent.serverSend;
     if (event == transportEventReceiveMessage) return TransportEvent.serverReceive;
     if (event == transportEventAccept) return TransportEvent.accept;
+    if (event == transportEventSplice) return TransportEvent.serverSplice;
     return TransportEvent.unknown;
   }
 
@@ -170,11 +187,12 @@ enum TransportEvent {
   }
 
   static TransportEvent clientEvent(int event) {
-    if (event == transportEventRead) return TransportEvent.clientRead;
+    if (event == transportEventRead || event == transportEventReadMultishot) return TransportEvent.clientRead;
     if (event == transportEventWrite) return TransportEvent.clientWrite;
     if (event == transportEventSendMessage) return TransportEvent.clientSend;
     if (event == transportEventReceiveMessage) return TransportEvent.clientReceive;
     if (event == transportEventConnect) return TransportEvent.connect;
+    if (event == transportEventSplice) return TransportEvent.clientSplice;
     return TransportEvent.unknown;
   }
 
@@ -199,7 +217,7 @@ class TransportMessages {
 
   static final workerMemoryError = "[worker] out of memory";
   static workerError(int result, TransportBindings bindings) => "[worker] code = $result, message = ${_kernelErrorToString(result, bindings)}";
-  static workerTrace(int id, int result, int data, int fd) => "worker = $id, result = $result,  bid = ${((data >> 16) & 0xffff)}, fd = $fd";
+  static workerTrace(int id, int result, int bufferId, int event, int fd) => "worker = $id, result = $result,  bid = $bufferId, event = $event, fd = $fd";
 
   static final serverMemoryError = "[server] out of memory";
   static final serverClosedError = "[server] closed";
@@ -216,6 +234,8 @@ class TransportMessages {
   static fileOpenError(String path) => "[file] open file failed: $path";
   static fileError(int result, TransportBindings bindings) => "[file] code = $result, message = ${_kernelErrorToString(result, bindings)}";
 
+  static final leaseInactive = "[lease] already committed or released";
+
   static internalError(TransportEvent event, int code, TransportBindings bindings) => "[$event] code = $code, message = ${_kernelErrorToString(code, bindings)}";
   static canceledError(TransportEvent event) => "[$event] canceled";
   static zeroDataError(TransportEvent event) => "[$event] completed with zero result (no data)";
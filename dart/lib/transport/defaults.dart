@@ -8,9 +8,21 @@ class TransportDefaults {
   static TransportWorkerConfiguration worker() => TransportWorkerConfiguration(
         trace: false,
         buffersCount: 4096,
+        providedBuffersCount: 0,
         bufferSize: 4096,
+        bufferClasses: [],
+        buffersGrowChunk: 1024,
+        buffersShrinkIdle: Duration(seconds: 30),
+        hugePages: false,
+        zeroBuffers: true,
+        registeredFilesCount: 0,
+        splicePipesCount: 16,
+        linkTimeouts: false,
+        eventfdWakeups: false,
+        ioThread: false,
         ringSize: 16384,
         ringFlags: 0,
+        submitFillFactor: 0.75,
         timeoutCheckerPeriod: Duration(milliseconds: 500),
         baseDelay: Duration(microseconds: 10),
         maxDelay: Duration(seconds: 5),
@@ -18,6 +30,7 @@ class TransportDefaults {
         cqePeekCount: 1024,
         cqeWaitCount: 1,
         cqeWaitTimeout: Duration(milliseconds: 1),
+        wideTags: false,
       );
 
   static TransportTcpClientConfiguration tcpClient() => TransportTcpClientConfiguration(
@@ -38,6 +38,7 @@ class TransportFilesFactory {
     final delegate = File(path);
     final fd = using((Arena arena) => _bindings.transport_file_open(path.toNativeUtf8(allocator: arena).cast(), mode.mode, truncate, create));
     if (fd < 0) throw TransportInitializationException(TransportMessages.fileOpenError(path));
+    _bindings.transport_worker_register_file(_workerPointer, fd);
     final file = TransportFileChannel(
       path,
       fd,
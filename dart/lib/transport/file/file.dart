@@ -30,6 +30,7 @@ class TransportFileChannel {
   var _closing = false;
   final _closer = Completer();
 
+  int get fd => _fd;
   bool get active => !_closing;
   Stream<TransportPayload> get inbound => _inboundEvents.stream;
 
@@ -87,6 +88,14 @@ class TransportFileChannel {
     _pending += count;
   }
 
+  bool vectored(List<Uint8List> bytes) {
+    if (bytes.length < 2) return false;
+    for (var index = 0; index < bytes.length - 1; index++) {
+      if (bytes[index].length != buffers.bufferSize) return false;
+    }
+    return true;
+  }
+
   Future<void> writeMany(
     List<Uint8List> bytes, {
     int offset = 0,
@@ -95,6 +104,18 @@ class TransportFileChannel {
   }) async {
     final bufferIds = await buffers.allocateArray(bytes.length);
     if (_closing) return Future.error(TransportClosedException.forFile());
+    if (vectored(bytes)) {
+      final bufferId = bufferIds.first;
+      final result = _channel.writeVector(bytes, bufferIds, transportEventWrite | transportEventFile, offset: offset);
+      if (result < 0) {
+        buffers.release(bufferId);
+        return Future.error(createTransportException(TransportEvent.fileWrite, result, _bindings));
+      }
+      if (onError != null) _outboundErrorHandlers[bufferId] = onError;
+      if (onDone != null) _outboundDoneHandlers[bufferId] = onDone;
+      _pending++;
+      return;
+    }
     final lastBufferId = bufferIds.last;
     for (var index = 0; index < bytes.length - 1; index++) {
       final bufferId = bufferIds[index];
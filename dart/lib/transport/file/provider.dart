@@ -16,6 +16,7 @@ class TransportFile {
 
   Stream<TransportPayload> get inbound => _file.inbound;
   bool get active => _file.active;
+  int get fd => _file.fd;
 
   @pragma(preferInlinePragma)
   void read({int blocksCount = 1, int offset = 0}) {
@@ -33,12 +34,13 @@ class TransportFile {
 
   @pragma(preferInlinePragma)
   void writeMany(List<Uint8List> bytes, {void Function(Exception error)? onError, void Function()? onDone}) {
+    final completions = _file.vectored(bytes) ? 1 : bytes.length;
     var doneCounter = 0;
     var errorCounter = 0;
     unawaited(_file.writeMany(bytes, onError: (error) {
-      if (++errorCounter + doneCounter == bytes.length) onError?.call(error);
+      if (++errorCounter + doneCounter == completions) onError?.call(error);
     }, onDone: () {
-      if (errorCounter == 0 && ++doneCounter == bytes.length) onDone?.call();
+      if (errorCounter == 0 && ++doneCounter == completions) onDone?.call();
     }).onError((error, stackTrace) => onError?.call(error as Exception)));
   }
 
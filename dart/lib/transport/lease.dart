@@ -0,0 +1,33 @@
+import 'dart:typed_data';
+
+import 'buffers.dart';
+import 'constants.dart';
+
+class TransportBufferLease {
+  final int _bufferId;
+  final Uint8List bytes;
+  final TransportBuffers _buffers;
+
+  var _active = true;
+
+  bool get active => _active;
+  int get capacity => bytes.length;
+
+  TransportBufferLease(this._bufferId, this.bytes, this._buffers);
+
+  @pragma(preferInlinePragma)
+  int commit(int length) {
+    if (!_active) throw StateError(TransportMessages.leaseInactive);
+    RangeError.checkValueInInterval(length, 0, bytes.length, "length");
+    _active = false;
+    _buffers.setLength(_bufferId, length);
+    return _bufferId;
+  }
+
+  @pragma(preferInlinePragma)
+  void release() {
+    if (!_active) return;
+    _active = false;
+    _buffers.release(_bufferId);
+  }
+}
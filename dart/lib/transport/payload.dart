@@ -30,6 +30,7 @@ class TransportPayload {
   final TransportPayloadPool _pool;
 
   Uint8List get bytes => _bytes;
+  int get bufferId => _bufferId;
 
   TransportPayload(this._bufferId, this._pool);
 
@@ -0,0 +1,42 @@
+import 'dart:ffi';
+
+import 'package:meta/meta.dart';
+
+import '../bindings.dart';
+import '../client/provider.dart';
+import '../constants.dart';
+import '../exception.dart';
+import '../server/provider.dart';
+import 'provider.dart';
+import 'proxy.dart';
+import 'registry.dart';
+
+class TransportProxiesFactory {
+  final TransportProxyRegistry _registry;
+  final TransportBindings _bindings;
+  final Pointer<transport_worker_t> _workerPointer;
+
+  const TransportProxiesFactory(
+    this._registry,
+    this._bindings,
+    this._workerPointer,
+  );
+
+  TransportProxy open(
+    TransportServerConnection connection,
+    TransportClientConnection client, {
+    int chunkSize = transportSpliceChunkSize,
+    void Function()? onClose,
+    void Function(Exception error)? onError,
+  }) {
+    final upstreamId = _bindings.transport_worker_proxy(_workerPointer, connection.fd, client.fd, chunkSize);
+    if (upstreamId < 0) throw createTransportException(TransportEvent.proxy, upstreamId, _bindings);
+    final downstreamId = _workerPointer.ref.splices.entries[upstreamId].peer;
+    final proxy = TransportProxyChannel(upstreamId, downstreamId, _workerPointer, _bindings, _registry, onClose, onError);
+    _registry.add(upstreamId, downstreamId, proxy);
+    return TransportProxy(proxy);
+  }
+
+  @visibleForTesting
+  TransportProxyRegistry get registry => _registry;
+}
@@ -0,0 +1,15 @@
+import '../constants.dart';
+import 'proxy.dart';
+
+class TransportProxy {
+  final TransportProxyChannel _proxy;
+
+  const TransportProxy(this._proxy);
+
+  bool get active => _proxy.active;
+  int get upstreamBytes => _proxy.upstreamBytes;
+  int get downstreamBytes => _proxy.downstreamBytes;
+
+  @pragma(preferInlinePragma)
+  Future<void> close() => _proxy.close();
+}
@@ -0,0 +1,57 @@
+import 'dart:async';
+import 'dart:ffi';
+
+import '../bindings.dart';
+import '../constants.dart';
+import '../exception.dart';
+import 'registry.dart';
+
+class TransportProxyChannel {
+  final int _upstreamId;
+  final int _downstreamId;
+  final Pointer<transport_worker_t> _workerPointer;
+  final TransportBindings _bindings;
+  final TransportProxyRegistry _registry;
+  final void Function()? _onClose;
+  final void Function(Exception error)? _onError;
+  final _closer = Completer();
+
+  var _pending = 2;
+  var _upstreamBytes = 0;
+  var _downstreamBytes = 0;
+  int? _error;
+
+  bool get active => _pending > 0;
+  int get upstreamBytes => _pending > 0 ? _workerPointer.ref.splices.entries[_upstreamId].transferred : _upstreamBytes;
+  int get downstreamBytes => _pending > 0 ? _workerPointer.ref.splices.entries[_downstreamId].transferred : _downstreamBytes;
+
+  TransportProxyChannel(
+    this._upstreamId,
+    this._downstreamId,
+    this._workerPointer,
+    this._bindings,
+    this._registry,
+    this._onClose,
+    this._onError,
+  );
+
+  void notify(int spliceId, int result) {
+    if (result < 0 && result != -ECANCELED) _error ??= result;
+    if (--_pending > 0) return;
+    _upstreamBytes = _workerPointer.ref.splices.entries[_upstreamId].transferred;
+    _downstreamBytes = _workerPointer.ref.splices.entries[_downstreamId].transferred;
+    _bindings.transport_worker_release_proxy(_workerPointer, _upstreamId);
+    _registry.remove(_upstreamId, _downstreamId);
+    _closer.complete();
+    if (_error != null) {
+      _onError?.call(createTransportException(TransportEvent.proxy, _error!, _bindings));
+      return;
+    }
+    _onClose?.call();
+  }
+
+  Future<void> close() {
+    if (_pending > 0) _bindings.transport_worker_close_proxy(_workerPointer, _upstreamId);
+    return _closer.future;
+  }
+}
@@ -0,0 +1,31 @@
+import 'package:meta/meta.dart';
+
+import '../constants.dart';
+import 'proxy.dart';
+
+class TransportProxyRegistry {
+  final _proxies = <int, TransportProxyChannel>{};
+
+  TransportProxyRegistry();
+
+  @pragma(preferInlinePragma)
+  TransportProxyChannel? get(int spliceId) => _proxies[spliceId];
+
+  @pragma(preferInlinePragma)
+  void remove(int upstreamId, int downstreamId) {
+    _proxies.remove(upstreamId);
+    _proxies.remove(downstreamId);
+  }
+
+  @pragma(preferInlinePragma)
+  void add(int upstreamId, int downstreamId, TransportProxyChannel proxy) {
+    _proxies[upstreamId] = proxy;
+    _proxies[downstreamId] = proxy;
+  }
+
+  @pragma(preferInlinePragma)
+  Future<void> close() => Future.wait(_proxies.values.toSet().map((proxy) => proxy.close()));
+
+  @visibleForTesting
+  Map<int, TransportProxyChannel> get proxies => _proxies;
+}
@@ -24,6 +24,12 @@ class TransportTcpServerConfiguration {
   final int? tcpMaxSegmentSize;
   final bool? tcpNoDelay;
   final int? tcpSynCount;
+  final bool? multishotAccept;
+  final int? zeroCopySendThreshold;
+  final TransportFraming? framing;
+  final int? coalesceThreshold;
+  final int? bufferQuota;
+  final int? bufferReservation;
 
   TransportTcpServerConfiguration({
     this.readTimeout,
@@ -49,6 +55,12 @@ class TransportTcpServerConfiguration {
     this.tcpMaxSegmentSize,
     this.tcpNoDelay,
     this.tcpSynCount,
+    this.multishotAccept,
+    this.zeroCopySendThreshold,
+    this.framing,
+    this.coalesceThreshold,
+    this.bufferQuota,
+    this.bufferReservation,
   });
 
   TransportTcpServerConfiguration copyWith({
@@ -75,6 +87,12 @@ class TransportTcpServerConfiguration {
     int? tcpMaxSegmentSize,
     bool? tcpNoDelay,
     int? tcpSynCount,
+    bool? multishotAccept,
+    int? zeroCopySendThreshold,
+    TransportFraming? framing,
+    int? coalesceThreshold,
+    int? bufferQuota,
+    int? bufferReservation,
   }) =>
       TransportTcpServerConfiguration(
         readTimeout: readTimeout ?? this.readTimeout,
@@ -100,6 +118,12 @@ class TransportTcpServerConfiguration {
         tcpMaxSegmentSize: tcpMaxSegmentSize ?? this.tcpMaxSegmentSize,
         tcpNoDelay: tcpNoDelay ?? this.tcpNoDelay,
         tcpSynCount: tcpSynCount ?? this.tcpSynCount,
+        multishotAccept: multishotAccept ?? this.multishotAccept,
+        zeroCopySendThreshold: zeroCopySendThreshold ?? this.zeroCopySendThreshold,
+        framing: framing ?? this.framing,
+        coalesceThreshold: coalesceThreshold ?? this.coalesceThreshold,
+        bufferQuota: bufferQuota ?? this.bufferQuota,
+        bufferReservation: bufferReservation ?? this.bufferReservation,
       );
 }
 
@@ -122,6 +146,7 @@ class TransportUdpServerConfiguration {
   final int? ipMulticastLoop;
   final int? ipMulticastTtl;
   final TransportUdpMulticastManager? multicastManager;
+  final int? zeroCopySendThreshold;
 
   TransportUdpServerConfiguration({
     this.readTimeout,
@@ -142,6 +167,7 @@ class TransportUdpServerConfiguration {
     this.ipMulticastLoop,
     this.ipMulticastTtl,
     this.multicastManager,
+    this.zeroCopySendThreshold,
   });
 
   TransportUdpServerConfiguration copyWith({
@@ -163,6 +189,7 @@ class TransportUdpServerConfiguration {
     int? ipMulticastLoop,
     int? ipMulticastTtl,
     TransportUdpMulticastManager? multicastManager,
+    int? zeroCopySendThreshold,
   }) =>
       TransportUdpServerConfiguration(
         readTimeout: readTimeout ?? this.readTimeout,
@@ -183,6 +210,7 @@ class TransportUdpServerConfiguration {
         ipMulticastLoop: ipMulticastLoop ?? this.ipMulticastLoop,
         ipMulticastTtl: ipMulticastTtl ?? this.ipMulticastTtl,
         multicastManager: multicastManager ?? this.multicastManager,
+        zeroCopySendThreshold: zeroCopySendThreshold ?? this.zeroCopySendThreshold,
       );
 }
 
@@ -197,6 +225,11 @@ class TransportUnixStreamServerConfiguration {
   final bool? socketKeepalive;
   final int? socketReceiveLowAt;
   final int? socketSendLowAt;
+  final bool? multishotAccept;
+  final TransportFraming? framing;
+  final int? coalesceThreshold;
+  final int? bufferQuota;
+  final int? bufferReservation;
 
   TransportUnixStreamServerConfiguration({
     this.readTimeout,
@@ -209,6 +242,11 @@ class TransportUnixStreamServerConfiguration {
     this.socketKeepalive,
     this.socketReceiveLowAt,
     this.socketSendLowAt,
+    this.multishotAccept,
+    this.framing,
+    this.coalesceThreshold,
+    this.bufferQuota,
+    this.bufferReservation,
   });
 
   TransportUnixStreamServerConfiguration copyWith({
@@ -222,6 +260,11 @@ class TransportUnixStreamServerConfiguration {
     bool? socketKeepalive,
     int? socketReceiveLowAt,
     int? socketSendLowAt,
+    bool? multishotAccept,
+    TransportFraming? framing,
+    int? coalesceThreshold,
+    int? bufferQuota,
+    int? bufferReservation,
   }) =>
       TransportUnixStreamServerConfiguration(
         readTimeout: readTimeout ?? this.readTimeout,
@@ -234,5 +277,10 @@ class TransportUnixStreamServerConfiguration {
         socketKeepalive: socketKeepalive ?? this.socketKeepalive,
         socketReceiveLowAt: socketReceiveLowAt ?? this.socketReceiveLowAt,
         socketSendLowAt: socketSendLowAt ?? this.socketSendLowAt,
+        multishotAccept: multishotAccept ?? this.multishotAccept,
+        framing: framing ?? this.framing,
+        coalesceThreshold: coalesceThreshold ?? this.coalesceThreshold,
+        bufferQuota: bufferQuota ?? this.bufferQuota,
+        bufferReservation: bufferReservation ?? this.bufferReservation,
       );
 }
@@ -67,12 +67,18 @@ class TransportServersFactory {
           pointer,
           _workerPointer,
           _bindings,
-          configuration.readTimeout?.inSeconds,
-          configuration.writeTimeout?.inSeconds,
+          configuration.readTimeout?.inMilliseconds,
+          configuration.writeTimeout?.inMilliseconds,
           _buffers,
           _registry,
           _payloadPool,
           _datagramResponderPool,
+          multishotAccept: configuration.multishotAccept ?? false,
+          zeroCopySendThreshold: configuration.zeroCopySendThreshold,
+          framing: configuration.framing,
+          coalesceThreshold: configuration.coalesceThreshold,
+          bufferQuota: configuration.bufferQuota,
+          bufferReservation: configuration.bufferReservation,
         );
       },
     );
@@ -147,8 +153,8 @@ class TransportServersFactory {
           pointer,
           _workerPointer,
           _bindings,
-          configuration.readTimeout?.inSeconds,
-          configuration.writeTimeout?.inSeconds,
+          configuration.readTimeout?.inMilliseconds,
+          configuration.writeTimeout?.inMilliseconds,
           _buffers,
           _registry,
           _payloadPool,
@@ -158,6 +164,7 @@ class TransportServersFactory {
             pointer.ref.fd,
             _bindings,
             _buffers,
+            zeroCopySendThreshold: configuration.zeroCopySendThreshold,
           ),
         );
       },
@@ -196,12 +203,17 @@ class TransportServersFactory {
           pointer,
           _workerPointer,
           _bindings,
-          configuration.readTimeout?.inSeconds,
-          configuration.writeTimeout?.inSeconds,
+          configuration.readTimeout?.inMilliseconds,
+          configuration.writeTimeout?.inMilliseconds,
           _buffers,
           _registry,
           _payloadPool,
           _datagramResponderPool,
+          multishotAccept: configuration.multishotAccept ?? false,
+          framing: configuration.framing,
+          coalesceThreshold: configuration.coalesceThreshold,
+          bufferQuota: configuration.bufferQuota,
+          bufferReservation: configuration.bufferReservation,
         );
       },
     );
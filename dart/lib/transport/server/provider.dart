@@ -2,6 +2,8 @@ import 'dart:async';
 import 'dart:typed_data';
 
 import '../constants.dart';
+import '../file/provider.dart';
+import '../lease.dart';
 import '../payload.dart';
 import 'responder.dart';
 import 'server.dart';
@@ -13,6 +15,7 @@ class TransportServerConnection {
 
   Stream<TransportPayload> get inbound => _connection.inbound;
   bool get active => _connection.active;
+  int get fd => _connection.fd;
 
   @pragma(preferInlinePragma)
   Future<void> read() => _connection.read();
@@ -33,21 +36,64 @@ class TransportServerConnection {
   }
 
   @pragma(preferInlinePragma)
-  void writeSingle(Uint8List bytes, {void Function(Exception error)? onError, void Function()? onDone}) {
-    unawaited(_connection.writeSingle(bytes, onError: onError, onDone: onDone).onError((error, stackTrace) => onError?.call(error as Exception)));
+  Stream<List<TransportPayload>> batches() => _connection.batches();
+
+  @pragma(preferInlinePragma)
+  void writeSingle(Uint8List bytes, {bool priority = false, void Function(Exception error)? onError, void Function()? onDone}) {
+    unawaited(_connection.writeSingle(bytes, priority: priority, onError: onError, onDone: onDone).onError((error, stackTrace) => onError?.call(error as Exception)));
+  }
+
+  @pragma(preferInlinePragma)
+  Future<TransportBufferLease> lease({int? size}) => _connection.lease(size: size);
+
+  @pragma(preferInlinePragma)
+  void writeLease(TransportBufferLease lease, int length, {void Function(Exception error)? onError, void Function()? onDone}) {
+    unawaited(_connection.writeLease(lease, length, onError: onError, onDone: onDone).onError((error, stackTrace) => onError?.call(error as Exception)));
+  }
+
+  @pragma(preferInlinePragma)
+  void forward(TransportPayload payload, {void Function(Exception error)? onError, void Function()? onDone}) {
+    unawaited(_connection.forward(payload, onError: onError, onDone: onDone).onError((error, stackTrace) => onError?.call(error as Exception)));
   }
 
   @pragma(preferInlinePragma)
   void writeMany(List<Uint8List> bytes, {bool linked = true, void Function(Exception error)? onError, void Function()? onDone}) {
+    final completions = linked ? 1 : bytes.length;
     var doneCounter = 0;
     var errorCounter = 0;
     unawaited(_connection.writeMany(bytes, linked: linked, onError: (error) {
-      if (++errorCounter + doneCounter == bytes.length) onError?.call(error);
+      if (++errorCounter + doneCounter == completions) onError?.call(error);
     }, onDone: () {
-      if (errorCounter == 0 && ++doneCounter == bytes.length) onDone?.call();
+      if (errorCounter == 0 && ++doneCounter == completions) onDone?.call();
     }).onError((error, stackTrace) => onError?.call(error as Exception)));
   }
 
+  @pragma(preferInlinePragma)
+  Future<void> flush() => _connection.flush();
+
+  @pragma(preferInlinePragma)
+  void sendFile(
+    TransportFile file, {
+    int offset = 0,
+    int? length,
+    int chunkSize = transportSpliceChunkSize,
+    void Function(int bytes)? onProgress,
+    void Function(Exception error)? onError,
+    void Function()? onDone,
+  }) {
+    unawaited(_connection
+        .sendFile(
+          file.fd,
+          offset,
+          length ?? file.delegate.lengthSync() - offset,
+          chunkSize: chunkSize,
+          onProgress: onProgress,
+          onError: onError,
+          onDone: onDone,
+        )
+        .onError((error, stackTrace) => onError?.call(error as Exception)));
+  }
+
   @pragma(preferInlinePragma)
   Future<void> close({Duration? gracefulTimeout}) => _connection.close(gracefulTimeout: gracefulTimeout);
 
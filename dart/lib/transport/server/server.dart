@@ -7,20 +7,35 @@ import 'registry.dart';
 import '../bindings.dart';
 import '../buffers.dart';
 import '../channel.dart';
+import '../coalescer.dart';
+import '../configuration.dart';
 import '../constants.dart';
 import '../exception.dart';
+import '../lease.dart';
 import '../payload.dart';
 import 'responder.dart';
 
 abstract class TransportServer {
+  Future<void> broadcast(
+    Uint8List bytes,
+    Iterable<TransportServerConnection> connections, {
+    void Function(TransportServerConnection connection, Exception error)? onError,
+    void Function(TransportServerConnection connection)? onDone,
+  });
+
   Future<void> close({Duration? gracefulTimeout});
 }
 
 class TransportServerConnectionChannel {
   final _closer = Completer();
   final _inboundEvents = StreamController<TransportPayload>();
+  StreamController<List<TransportPayload>>? _batches;
+  var _batch = <TransportPayload>[];
   final _outboundDoneHandlers = <int, void Function()>{};
   final _outboundErrorHandlers = <int, void Function(Exception error)>{};
+  final _spliceProgressHandlers = <int, void Function(int bytes)>{};
+  final _spliceDoneHandlers = <int, void Function()>{};
+  final _spliceErrorHandlers = <int, void Function(Exception error)>{};
 
   final int? _readTimeout;
   final int? _writeTimeout;
@@ -34,9 +49,11 @@ class TransportServerConnectionChannel {
 
   var _active = true;
   var _closing = false;
+  var _reading = false;
   var _pending = 0;
 
   bool get active => !_closing;
+  int get fd => _fd;
   Stream<TransportPayload> get inbound => _inboundEvents.stream;
 
   TransportServerConnectionChannel(
@@ -52,14 +69,71 @@ class TransportServerConnectionChannel {
   );
 
   Future<void> read() async {
-    final bufferId = _buffers.get() ?? await _buffers.allocate();
+    if (channel.framing != null) return _readFramed();
+    if (_buffers.providedBuffersCount > 0) return _readMultishot();
+    if (_batches != null) return _readStream();
+    final bufferId = _buffers.get(quota: channel.quota) ?? await _buffers.allocate(quota: channel.quota);
     if (_closing || _server._closing) return Future.error(TransportClosedException.forServer());
     channel.read(bufferId, transportEventRead | transportEventServer, timeout: _readTimeout);
     _pending++;
   }
 
-  Future<void> writeSingle(Uint8List bytes, {void Function(Exception error)? onError, void Function()? onDone}) async {
-    final bufferId = _buffers.get() ?? await _buffers.allocate();
+  Stream<List<TransportPayload>> batches() {
+    final out = StreamController<List<TransportPayload>>(sync: true);
+    _batches = out;
+    out.onListen = () => unawaited(read().onError((error, stackTrace) => out.addError(error!)));
+    return out.stream;
+  }
+
+  @pragma(preferInlinePragma)
+  Future<void> _readStream() async {
+    if (_closing || _server._closing) return Future.error(TransportClosedException.forServer());
+    if (_reading) return;
+    _reading = true;
+    final bufferId = _buffers.get(quota: channel.quota) ?? await _buffers.allocate(quota: channel.quota);
+    if (_closing || _server._closing) {
+      _reading = false;
+      _buffers.release(bufferId);
+      return Future.error(TransportClosedException.forServer());
+    }
+    final result = channel.readStream(bufferId, transportEventRead | transportEventServer, timeout: _readTimeout);
+    if (result < 0) {
+      _reading = false;
+      _buffers.release(bufferId);
+      return Future.error(createTransportException(TransportEvent.serverRead, result, _bindings));
+    }
+    _pending++;
+  }
+
+  @pragma(preferInlinePragma)
+  Future<void> _readMultishot() async {
+    if (_closing || _server._closing) return Future.error(TransportClosedException.forServer());
+    if (_reading) return;
+    channel.readMultishot(transportEventReadMultishot | transportEventServer, timeout: _readTimeout);
+    _reading = true;
+    _pending++;
+  }
+
+  @pragma(preferInlinePragma)
+  Future<void> _readFramed() async {
+    if (_closing || _server._closing) return Future.error(TransportClosedException.forServer());
+    if (_reading) return;
+    final result = channel.readFramed(transportEventReadMultishot | transportEventServer, timeout: _readTimeout);
+    if (result < 0) return Future.error(createTransportException(TransportEvent.serverRead, result, _bindings));
+    _reading = true;
+    _pending++;
+  }
+
+  Future<void> writeSingle(Uint8List bytes, {bool priority = false, void Function(Exception error)? onError, void Function()? onDone}) async {
+    final coalescer = channel.coalescer;
+    if (coalescer != null) {
+      if (_closing || _server._closing) return Future.error(TransportClosedException.forServer());
+      if (coalescer.add(bytes, onError, onDone) || priority) return flush(priority: priority);
+      coalescer.schedule(() => unawaited(flush()));
+      return;
+    }
+    final bufferId = _buffers.get(size: bytes.length, quota: channel.quota, priority: priority) ??
+        await _buffers.allocate(size: bytes.length, quota: channel.quota, priority: priority);
     if (_closing || _server._closing) return Future.error(TransportClosedException.forServer());
     if (onError != null) _outboundErrorHandlers[bufferId] = onError;
     if (onDone != null) _outboundDoneHandlers[bufferId] = onDone;
@@ -67,9 +141,57 @@ class TransportServerConnectionChannel {
     _pending++;
   }
 
+  Future<TransportBufferLease> lease({int? size}) async {
+    final bufferId = _buffers.get(size: size, quota: channel.quota) ?? await _buffers.allocate(size: size, quota: channel.quota);
+    if (_closing || _server._closing) {
+      _buffers.release(bufferId);
+      return Future.error(TransportClosedException.forServer());
+    }
+    return TransportBufferLease(bufferId, _buffers.read(bufferId), _buffers);
+  }
+
+  Future<void> writeLease(TransportBufferLease lease, int length, {void Function(Exception error)? onError, void Function()? onDone}) async {
+    if (channel.coalescer != null) await flush();
+    if (_closing || _server._closing) {
+      lease.release();
+      return Future.error(TransportClosedException.forServer());
+    }
+    _writeBuffer(lease.commit(length), length, onError, onDone);
+  }
+
+  Future<void> forward(TransportPayload payload, {void Function(Exception error)? onError, void Function()? onDone}) async {
+    if (channel.coalescer != null) await flush();
+    if (_closing || _server._closing) {
+      payload.release();
+      return Future.error(TransportClosedException.forServer());
+    }
+    _writeBuffer(payload.bufferId, payload.bytes.length, onError, onDone);
+  }
+
+  @pragma(preferInlinePragma)
+  void _writeBuffer(int bufferId, int length, void Function(Exception error)? onError, void Function()? onDone) {
+    if (onError != null) _outboundErrorHandlers[bufferId] = onError;
+    if (onDone != null) _outboundDoneHandlers[bufferId] = onDone;
+    channel.writeBuffer(bufferId, length, transportEventWrite | transportEventServer, timeout: _writeTimeout);
+    _pending++;
+  }
+
   Future<void> writeMany(List<Uint8List> bytes, {bool linked = true, void Function(Exception error)? onError, void Function()? onDone}) async {
-    final bufferIds = await _buffers.allocateArray(bytes.length);
+    if (channel.coalescer != null) await flush();
+    final bufferIds = await _buffers.allocateArray(bytes.length, sizes: bytes.map((payload) => payload.length).toList(), quota: channel.quota);
     if (_closing || _server._closing) return Future.error(TransportClosedException.forServer());
+    if (linked && bytes.length > 1) {
+      final bufferId = bufferIds.first;
+      final result = channel.writeVector(bytes, bufferIds, transportEventWrite | transportEventServer, timeout: _writeTimeout);
+      if (result < 0) {
+        _buffers.release(bufferId);
+        return Future.error(createTransportException(TransportEvent.serverWrite, result, _bindings));
+      }
+      if (onError != null) _outboundErrorHandlers[bufferId] = onError;
+      if (onDone != null) _outboundDoneHandlers[bufferId] = onDone;
+      _pending++;
+      return;
+    }
     final lastBufferId = bufferIds.last;
     for (var index = 0; index < bytes.length - 1; index++) {
       final bufferId = bufferIds[index];
@@ -94,8 +216,68 @@ class TransportServerConnectionChannel {
     _pending += bytes.length;
   }
 
-  void notify(int bufferId, int result, int event) {
-    _pending--;
+  Future<void> sendFile(
+    int sourceFd,
+    int offset,
+    int length, {
+    int chunkSize = transportSpliceChunkSize,
+    void Function(int bytes)? onProgress,
+    void Function(Exception error)? onError,
+    void Function()? onDone,
+  }) async {
+    if (channel.coalescer != null) await flush();
+    if (_closing || _server._closing) return Future.error(TransportClosedException.forServer());
+    final spliceId = channel.sendFile(sourceFd, offset, length, transportEventSplice | transportEventServer, chunkSize: chunkSize, timeout: _writeTimeout);
+    if (spliceId < 0) return Future.error(createTransportException(TransportEvent.serverSplice, spliceId, _bindings));
+    if (onProgress != null) _spliceProgressHandlers[spliceId] = onProgress;
+    if (onError != null) _spliceErrorHandlers[spliceId] = onError;
+    if (onDone != null) _spliceDoneHandlers[spliceId] = onDone;
+    _pending++;
+  }
+
+  Future<void> flush({bool priority = false}) {
+    final coalescer = channel.coalescer;
+    if (coalescer == null || coalescer.isEmpty) return Future.value();
+    final batch = coalescer.take(_buffers.maxBufferSize);
+    return coalescer.chain(() => _writeBatch(batch, priority));
+  }
+
+  Future<void> _writeBatch(TransportWriteBatch batch, bool priority) async {
+    if (batch.chunks.isEmpty) {
+      batch.onDone?.call();
+      return;
+    }
+    final bufferIds = await _buffers.allocateArray(batch.chunks.length, sizes: batch.sizes, quota: channel.quota, priority: priority);
+    if (_closing || _server._closing) {
+      _buffers.releaseArray(bufferIds);
+      batch.onError?.call(TransportClosedException.forServer());
+      return;
+    }
+    final bufferId = bufferIds.first;
+    final result = channel.writeBatch(batch, bufferIds, transportEventWrite | transportEventServer, timeout: _writeTimeout);
+    if (result < 0) {
+      _buffers.release(bufferId);
+      batch.onError?.call(createTransportException(TransportEvent.serverWrite, result, _bindings));
+      return;
+    }
+    final onError = batch.onError;
+    final onDone = batch.onDone;
+    if (onError != null) _outboundErrorHandlers[bufferId] = onError;
+    if (onDone != null) _outboundDoneHandlers[bufferId] = onDone;
+    _pending++;
+  }
+
+  void notify(int bufferId, int result, int event, int flags) {
+    if (event == transportEventReadMultishot) {
+      _notifyReadMultishot(bufferId, result, flags);
+      return;
+    }
+    if (event == transportEventSplice) {
+      _notifySplice(bufferId, result, flags);
+      return;
+    }
+    if (event == transportEventRead && flags & transportCqeFMore == 0) _reading = false;
+    if (flags & transportCqeFMore == 0) _pending--;
     if (_active) {
       if (_pending == 0 && _closing) {
         _active = false;
@@ -104,18 +286,22 @@ class TransportServerConnectionChannel {
       if (event == transportEventRead) {
         if (result > 0) {
           _buffers.setLength(bufferId, result);
-          _inboundEvents.add(_payloadPool.getPayload(bufferId, _buffers.read(bufferId)));
+          _deliver(_payloadPool.getPayload(bufferId, _buffers.read(bufferId)));
           return;
         }
         _buffers.release(bufferId);
         if (result < 0) {
-          _inboundEvents.addError(createTransportException(TransportEvent.serverEvent(event), result, _bindings));
+          _deliverError(createTransportException(TransportEvent.serverEvent(event), result, _bindings));
         }
         unawaited(close());
         return;
       }
       if (event == transportEventWrite) {
-        _buffers.release(bufferId);
+        if (flags & transportCqeFNotif != 0) {
+          _buffers.release(bufferId);
+          return;
+        }
+        if (flags & transportCqeFMore == 0) _buffers.release(bufferId);
         if (result > 0) {
           _outboundDoneHandlers.remove(bufferId)?.call();
           return;
@@ -127,7 +313,89 @@ class TransportServerConnectionChannel {
       _buffers.release(bufferId);
       return;
     }
-    _buffers.release(bufferId);
+    if (event == transportEventRead || flags & transportCqeFMore == 0) _buffers.release(bufferId);
+    if (_pending == 0 && _closing && !_closer.isCompleted) _closer.complete();
+  }
+
+  @pragma(preferInlinePragma)
+  void _deliver(TransportPayload payload) {
+    if (_batches == null) {
+      _inboundEvents.add(payload);
+      return;
+    }
+    if (_batch.isEmpty) scheduleMicrotask(_flushBatch);
+    _batch.add(payload);
+  }
+
+  @pragma(preferInlinePragma)
+  void _deliverError(Exception error) {
+    if (_batches == null) {
+      _inboundEvents.addError(error);
+      return;
+    }
+    _flushBatch();
+    _batches!.addError(error);
+  }
+
+  void _flushBatch() {
+    if (_batch.isEmpty) return;
+    final batch = _batch;
+    _batch = [];
+    _batches!.add(batch);
+    if (!_reading && !(_closing || _server._closing)) unawaited(read().onError((error, stackTrace) => _batches!.addError(error!)));
+  }
+
+  void _notifyReadMultishot(int bufferId, int result, int flags) {
+    final selected = flags & transportCqeFBuffer != 0;
+    if (flags & transportCqeFMore == 0) {
+      _reading = false;
+      _pending--;
+    }
+    if (_active) {
+      if (_pending == 0 && _closing) {
+        _active = false;
+        _closer.complete();
+      }
+      if (result > 0 || result == 0 && selected && flags & transportCqeFMore != 0) {
+        _buffers.setLength(bufferId, result);
+        _deliver(_payloadPool.getPayload(bufferId, _buffers.read(bufferId)));
+        return;
+      }
+      if (selected) _buffers.release(bufferId);
+      if (result == -ENOBUFS) {
+        unawaited(_buffers.released().then((_) => _closing || _server._closing ? null : read()));
+        return;
+      }
+      if (result < 0) {
+        _deliverError(createTransportException(TransportEvent.serverEvent(transportEventReadMultishot), result, _bindings));
+      }
+      unawaited(close());
+      return;
+    }
+    if (selected) _buffers.release(bufferId);
+    if (_pending == 0 && _closing && !_closer.isCompleted) _closer.complete();
+  }
+
+  void _notifySplice(int spliceId, int result, int flags) {
+    if (result > 0) _spliceProgressHandlers[spliceId]?.call(result);
+    if (flags & transportCqeFMore != 0) return;
+    _pending--;
+    _spliceProgressHandlers.remove(spliceId);
+    final onDone = _spliceDoneHandlers.remove(spliceId);
+    final onError = _spliceErrorHandlers.remove(spliceId);
+    if (_active) {
+      if (_pending == 0 && _closing) {
+        _active = false;
+        _closer.complete();
+      }
+      if (result >= 0) {
+        onDone?.call();
+        return;
+      }
+      onError?.call(createTransportException(TransportEvent.serverSplice, result, _bindings));
+      unawaited(close());
+      return;
+    }
     if (_pending == 0 && _closing && !_closer.isCompleted) _closer.complete();
   }
 
@@ -138,7 +406,16 @@ class TransportServerConnectionChannel {
       }
       return;
     }
+    final coalescer = channel.coalescer;
+    if (coalescer != null && !coalescer.isEmpty) {
+      if (gracefulTimeout != null) {
+        await flush();
+      } else {
+        coalescer.take(_buffers.maxBufferSize).onError?.call(TransportClosedException.forServer());
+      }
+    }
     _closing = true;
+    channel.clearStream();
     if (_pending > 0) {
       if (gracefulTimeout == null) {
         _active = false;
@@ -158,8 +435,12 @@ class TransportServerConnectionChannel {
     }
     _active = false;
     if (_inboundEvents.hasListener) await _inboundEvents.close();
+    if (_batches != null) {
+      _flushBatch();
+      if (_batches!.hasListener) await _batches!.close();
+    }
     _server._removeConnection(_fd);
-    _bindings.transport_close_descriptor(_fd);
+    channel.close();
   }
 
   Future<void> closeServer({Duration? gracefulTimeout}) => _server.close(gracefulTimeout: gracefulTimeout);
@@ -182,6 +463,12 @@ class TransportServerChannel implements TransportServer {
   final TransportServerRegistry _registry;
   final TransportPayloadPool _payloadPool;
   final TransportServerDatagramResponderPool _datagramResponderPool;
+  final bool _multishotAccept;
+  final int? _zeroCopySendThreshold;
+  final TransportFraming? _framing;
+  final int? _coalesceThreshold;
+  final int? _bufferQuota;
+  final int? _bufferReservation;
 
   late void Function(TransportServerConnection connection) _acceptor;
 
@@ -203,12 +490,33 @@ class TransportServerChannel implements TransportServer {
     this._payloadPool,
     this._datagramResponderPool, {
     TransportChannel? datagramChannel,
-  }) : this._datagramChannel = datagramChannel;
+    bool multishotAccept = false,
+    int? zeroCopySendThreshold,
+    TransportFraming? framing,
+    int? coalesceThreshold,
+    int? bufferQuota,
+    int? bufferReservation,
+  })  : this._datagramChannel = datagramChannel,
+        this._multishotAccept = multishotAccept,
+        this._zeroCopySendThreshold = zeroCopySendThreshold,
+        this._framing = framing,
+        this._coalesceThreshold = coalesceThreshold,
+        this._bufferQuota = bufferQuota,
+        this._bufferReservation = bufferReservation;
 
   @pragma(preferInlinePragma)
   void accept(void Function(TransportServerConnection connection) onAccept) {
     if (_closing) throw TransportClosedException.forServer();
     _acceptor = onAccept;
+    _accept();
+  }
+
+  @pragma(preferInlinePragma)
+  void _accept() {
+    if (_multishotAccept) {
+      _bindings.transport_worker_accept_multishot(_workerPointer, pointer);
+      return;
+    }
     _bindings.transport_worker_accept(_workerPointer, pointer);
   }
 
@@ -235,7 +543,7 @@ class TransportServerChannel implements TransportServer {
     void Function()? onDone,
   }) async {
     flags = flags ?? TransportDatagramMessageFlag.trunc.flag;
-    final bufferId = _buffers.get() ?? await _buffers.allocate();
+    final bufferId = _buffers.get(size: bytes.length) ?? await _buffers.allocate(size: bytes.length);
     if (_closing) return Future.error(TransportClosedException.forServer());
     if (onError != null) _outboundErrorHandlers[bufferId] = onError;
     if (onDone != null) _outboundDoneHandlers[bufferId] = onDone;
@@ -261,7 +569,7 @@ class TransportServerChannel implements TransportServer {
     void Function()? onDone,
   }) async {
     flags = flags ?? TransportDatagramMessageFlag.trunc.flag;
-    final bufferIds = await _buffers.allocateArray(bytes.length);
+    final bufferIds = await _buffers.allocateArray(bytes.length, sizes: bytes.map((payload) => payload.length).toList());
     if (_closing) return Future.error(TransportClosedException.forServer());
     final lastBufferId = bufferIds.last;
     for (var index = 0; index < bytes.length - 1; index++) {
@@ -294,8 +602,8 @@ class TransportServerChannel implements TransportServer {
     _pending += bytes.length;
   }
 
-  void notifyDatagram(int bufferId, int result, int event) {
-    _pending--;
+  void notifyDatagram(int bufferId, int result, int event, int flags) {
+    if (flags & transportCqeFMore == 0) _pending--;
     if (_active) {
       if (_pending == 0 && _closing) {
         _active = false;
@@ -320,7 +628,11 @@ class TransportServerChannel implements TransportServer {
         return;
       }
       if (event == transportEventSendMessage) {
-        _buffers.release(bufferId);
+        if (flags & transportCqeFNotif != 0) {
+          _buffers.release(bufferId);
+          return;
+        }
+        if (flags & transportCqeFMore == 0) _buffers.release(bufferId);
         if (result > 0) {
           _outboundDoneHandlers.remove(bufferId)?.call();
           return;
@@ -331,15 +643,29 @@ class TransportServerChannel implements TransportServer {
       _buffers.release(bufferId);
       return;
     }
-    _buffers.release(bufferId);
+    if (flags & transportCqeFMore == 0) _buffers.release(bufferId);
     if (_pending == 0 && _closing && !_closer.isCompleted) _closer.complete();
   }
 
   @pragma(preferInlinePragma)
-  void notifyAccept(int fd) {
-    if (_closing) return;
+  void notifyAccept(int fd, int flags) {
+    if (_closing) {
+      if (fd > 0) _bindings.transport_close_descriptor(fd);
+      return;
+    }
     if (fd > 0) {
-      final channel = TransportChannel(_workerPointer, fd, _bindings, _buffers);
+      _bindings.transport_worker_register_file(_workerPointer, fd);
+      final channel = TransportChannel(
+        _workerPointer,
+        fd,
+        _bindings,
+        _buffers,
+        zeroCopySendThreshold: _zeroCopySendThreshold,
+        framing: _framing,
+        coalesceThreshold: _coalesceThreshold,
+        bufferQuota: _bufferQuota,
+        bufferReservation: _bufferReservation,
+      );
       final connection = TransportServerConnectionChannel(
         this,
         _buffers,
@@ -355,7 +681,8 @@ class TransportServerChannel implements TransportServer {
       _connections[fd] = connection;
       _acceptor(TransportServerConnection(connection));
     }
-    _bindings.transport_worker_accept(_workerPointer, pointer);
+    if (flags & transportCqeFMore != 0) return;
+    _accept();
   }
 
   @pragma(preferInlinePragma)
@@ -367,6 +694,53 @@ class TransportServerChannel implements TransportServer {
     _registry.removeConnection(fd);
   }
 
+  @override
+  Future<void> broadcast(
+    Uint8List bytes,
+    Iterable<TransportServerConnection> connections, {
+    void Function(TransportServerConnection connection, Exception error)? onError,
+    void Function(TransportServerConnection connection)? onDone,
+  }) async {
+    if (_closing) return Future.error(TransportClosedException.forServer());
+    final bufferId = _buffers.get(size: bytes.length) ?? await _buffers.allocate(size: bytes.length);
+    if (_closing) {
+      _buffers.release(bufferId);
+      return Future.error(TransportClosedException.forServer());
+    }
+    final shared = <int, TransportServerConnection>{};
+    final copied = <int, TransportServerConnection>{};
+    for (var connection in connections) {
+      final channel = _connections[connection.fd];
+      if (channel == null || channel._closing) continue;
+      final coalescer = channel.channel.coalescer;
+      (coalescer == null || coalescer.isEmpty ? shared : copied).putIfAbsent(connection.fd, () => connection);
+    }
+    if (shared.length > 1 && _bindings.transport_worker_share_buffer(_workerPointer, bufferId, shared.length) < 0) {
+      copied.addAll(shared);
+      shared.clear();
+    }
+    if (shared.isEmpty) {
+      _buffers.release(bufferId);
+    } else {
+      _buffers.write(bufferId, bytes);
+      for (var connection in shared.values) {
+        _connections[connection.fd]!._writeBuffer(
+          bufferId,
+          bytes.length,
+          onError == null ? null : (error) => onError(connection, error),
+          onDone == null ? null : () => onDone(connection),
+        );
+      }
+    }
+    for (var connection in copied.values) {
+      connection.writeSingle(
+        bytes,
+        onError: onError == null ? null : (error) => onError(connection, error),
+        onDone: onDone == null ? null : () => onDone(connection),
+      );
+    }
+  }
+
   @override
   Future<void> close({Duration? gracefulTimeout}) async {
     if (_closing) {
@@ -43,8 +43,27 @@ class Transport {
         final nativeConfiguration = arena<transport_worker_configuration_t>();
         nativeConfiguration.ref.ring_flags = configuration.ringFlags;
         nativeConfiguration.ref.ring_size = configuration.ringSize;
+        nativeConfiguration.ref.submit_fill_factor = configuration.submitFillFactor;
         nativeConfiguration.ref.buffer_size = configuration.bufferSize;
+        final bufferClasses = configuration.bufferClasses.take(TRANSPORT_BUFFER_CLASSES_MAX).toList();
+        for (var index = 0; index < bufferClasses.length; index++) {
+          nativeConfiguration.ref.buffer_class_sizes[index] = bufferClasses[index].size;
+          nativeConfiguration.ref.buffer_class_counts[index] = bufferClasses[index].count;
+        }
+        nativeConfiguration.ref.buffer_classes_count = bufferClasses.length;
+        nativeConfiguration.ref.max_buffers_count = configuration.maxBuffersCount ?? 0;
+        nativeConfiguration.ref.buffers_grow_chunk = configuration.buffersGrowChunk;
+        nativeConfiguration.ref.buffers_shrink_idle_millis = configuration.buffersShrinkIdle.inMilliseconds;
+        nativeConfiguration.ref.huge_pages = configuration.hugePages;
+        nativeConfiguration.ref.zero_buffers = configuration.zeroBuffers;
+        nativeConfiguration.ref.registered_files_count = configuration.registeredFilesCount;
+        nativeConfiguration.ref.splice_pipes_count = configuration.splicePipesCount;
+        nativeConfiguration.ref.link_timeouts = configuration.linkTimeouts;
+        nativeConfiguration.ref.eventfd_wakeups = configuration.eventfdWakeups;
+        nativeConfiguration.ref.io_thread = configuration.ioThread;
+        nativeConfiguration.ref.io_thread_cpu = configuration.ioThreadCpu ?? -1;
         nativeConfiguration.ref.buffers_count = max(configuration.buffersCount, 2);
+        nativeConfiguration.ref.provided_buffers_count = configuration.providedBuffersCount;
         nativeConfiguration.ref.timeout_checker_period_millis = configuration.timeoutCheckerPeriod.inMilliseconds;
         nativeConfiguration.ref.base_delay_micros = configuration.baseDelay.inMicroseconds;
         nativeConfiguration.ref.max_delay_micros = configuration.maxDelay.inMicroseconds;
@@ -52,6 +71,7 @@ class Transport {
         nativeConfiguration.ref.cqe_peek_count = configuration.cqePeekCount;
         nativeConfiguration.ref.cqe_wait_count = configuration.cqeWaitCount;
         nativeConfiguration.ref.cqe_wait_timeout_millis = configuration.cqeWaitTimeout.inMilliseconds;
+        nativeConfiguration.ref.wide_tags = configuration.wideTags;
         nativeConfiguration.ref.trace = configuration.trace;
         return _bindings.transport_worker_initialize(workerPointer, nativeConfiguration, _workerClosers.length);
       });
@@ -2,6 +2,7 @@ import 'dart:async';
 import 'dart:ffi';
 import 'dart:isolate';
 import 'dart:math';
+import 'dart:typed_data';
 
 import 'package:meta/meta.dart';
 
@@ -10,10 +11,13 @@ import 'buffers.dart';
 import 'client/factory.dart';
 import 'client/registry.dart';
 import 'constants.dart';
+import 'exception.dart';
 import 'file/factory.dart';
 import 'file/registry.dart';
 import 'lookup.dart';
 import 'payload.dart';
+import 'proxy/factory.dart';
+import 'proxy/registry.dart';
 import 'server/factory.dart';
 import 'server/registry.dart';
 import 'server/responder.dart';
@@ -25,7 +29,11 @@ class TransportWorker {
   late final TransportBindings _bindings;
   late final Pointer<transport_worker_t> _workerPointer;
   late final Pointer<io_uring> _ring;
-  late final Pointer<Pointer<io_uring_cqe>> _cqes;
+  late final Uint32List _completionFds;
+  late final Uint32List _completionBufferIds;
+  late final Uint16List _completionEvents;
+  late final Int32List _completionResults;
+  late final Uint32List _completionFlags;
   late final RawReceivePort _closer;
   late final SendPort _destroyer;
   late final TransportClientRegistry _clientRegistry;
@@ -34,8 +42,12 @@ class TransportWorker {
   late final TransportServersFactory _serversFactory;
   late final TransportFileRegistry _filesRegistry;
   late final TransportFilesFactory _filesFactory;
+  late final TransportProxyRegistry _proxyRegistry;
+  late final TransportProxiesFactory _proxiesFactory;
   late final TransportBuffers _buffers;
-  late final TransportTimeoutChecker _timeoutChecker;
+  TransportTimeoutChecker? _timeoutChecker;
+  NativeCallable<Void Function()>? _wakeups;
+  Completer<void>? _parked;
   late final TransportPayloadPool _payloadPool;
   late final TransportServerDatagramResponderPool _datagramResponderPool;
   late final List<Duration> _delays;
@@ -49,15 +61,22 @@ class TransportWorker {
   TransportServersFactory get servers => _serversFactory;
   TransportClientsFactory get clients => _clientsFactory;
   TransportFilesFactory get files => _filesFactory;
+  TransportProxiesFactory get proxies => _proxiesFactory;
 
   TransportWorker(SendPort toTransport) {
     _closer = RawReceivePort((gracefulTimeout) async {
-      _timeoutChecker.stop();
+      _timeoutChecker?.stop();
+      await _proxyRegistry.close();
       await _filesRegistry.close(gracefulTimeout: gracefulTimeout);
       await _clientRegistry.close(gracefulTimeout: gracefulTimeout);
       await _serverRegistry.close(gracefulTimeout: gracefulTimeout);
       _active = false;
+      _unpark();
       await _done.future;
+      if (_wakeups != null) {
+        _bindings.transport_worker_stop_wakeups(_workerPointer);
+        _wakeups!.close();
+      }
       _bindings.transport_worker_destroy(_workerPointer);
       _closer.close();
       _destroyer.send(null);
@@ -77,8 +96,8 @@ class TransportWorker {
       _workerPointer.ref.buffers,
       _workerPointer,
     );
-    _payloadPool = TransportPayloadPool(_workerPointer.ref.buffers_count, _buffers);
-    _datagramResponderPool = TransportServerDatagramResponderPool(_workerPointer.ref.buffers_count, _buffers);
+    _payloadPool = TransportPayloadPool(_workerPointer.ref.buffers_capacity, _buffers);
+    _datagramResponderPool = TransportServerDatagramResponderPool(_workerPointer.ref.buffers_capacity, _buffers);
     _clientRegistry = TransportClientRegistry();
     _serverRegistry = TransportServerRegistry();
     _serversFactory = TransportServersFactory(
@@ -104,15 +123,37 @@ class TransportWorker {
       _buffers,
       _payloadPool,
     );
-    _ring = _workerPointer.ref.ring;
-    _cqes = _workerPointer.ref.cqes;
-    _timeoutChecker = TransportTimeoutChecker(
+    _proxyRegistry = TransportProxyRegistry();
+    _proxiesFactory = TransportProxiesFactory(
+      _proxyRegistry,
       _bindings,
       _workerPointer,
-      Duration(milliseconds: _workerPointer.ref.timeout_checker_period_millis),
     );
+    _ring = _workerPointer.ref.ring;
+    final cqePeekCount = _workerPointer.ref.cqe_peek_count;
+    _completionFds = _workerPointer.ref.completion_fds.asTypedList(cqePeekCount);
+    _completionBufferIds = _workerPointer.ref.completion_buffer_ids.asTypedList(cqePeekCount);
+    _completionEvents = _workerPointer.ref.completion_events.asTypedList(cqePeekCount);
+    _completionResults = _workerPointer.ref.completion_results.asTypedList(cqePeekCount);
+    _completionFlags = _workerPointer.ref.completion_flags.asTypedList(cqePeekCount);
+    if (!_workerPointer.ref.link_timeouts && !_workerPointer.ref.io_thread) {
+      _timeoutChecker = TransportTimeoutChecker(
+        _bindings,
+        _workerPointer,
+        Duration(milliseconds: _workerPointer.ref.timeout_checker_period_millis),
+      );
+      _timeoutChecker!.start();
+    }
     _delays = _calculateDelays();
-    _timeoutChecker.start();
+    if (_workerPointer.ref.eventfd_wakeups || _workerPointer.ref.io_thread) {
+      final wakeups = NativeCallable<Void Function()>.listener(_unpark);
+      final result = _bindings.transport_worker_start_wakeups(_workerPointer, wakeups.nativeFunction);
+      if (result < 0) {
+        wakeups.close();
+        throw TransportInitializationException(TransportMessages.workerError(result, _bindings));
+      }
+      _wakeups = wakeups;
+    }
     unawaited(_listen());
   }
 
@@ -127,23 +168,37 @@ class TransportWorker {
         await Future.delayed(regularDelayDuration);
         continue;
       }
+      if (_wakeups != null) {
+        await _park();
+        continue;
+      }
       await Future.delayed(_delays[min(attempt, 31)]);
     }
     _done.complete();
   }
 
+  Future<void> _park() {
+    if (!_bindings.transport_worker_park(_workerPointer)) return Future.value();
+    _parked = Completer();
+    return _parked!.future.whenComplete(() => _workerPointer.ref.parked = false);
+  }
+
+  void _unpark() {
+    final parked = _parked;
+    if (parked == null || parked.isCompleted) return;
+    parked.complete();
+  }
+
   bool _handleCqes() {
-    final cqeCount = _bindings.transport_worker_peek(_workerPointer);
-    if (cqeCount == 0) return false;
-    for (var cqeIndex = 0; cqeIndex < cqeCount; cqeIndex++) {
-      final cqe = _cqes.elementAt(cqeIndex).value;
-      final data = cqe.ref.user_data;
-      _bindings.transport_worker_remove_event(_workerPointer, data);
-      final result = cqe.ref.res;
-      var event = data & 0xffff;
-      final fd = (data >> 32) & 0xffffffff;
-      final bufferId = (data >> 16) & 0xffff;
-      if (_workerPointer.ref.trace) print(TransportMessages.workerTrace(id, result, data, fd));
+    final completionsCount = _bindings.transport_worker_drain(_workerPointer);
+    if (completionsCount == 0) return false;
+    for (var completionIndex = 0; completionIndex < completionsCount; completionIndex++) {
+      final fd = _completionFds[completionIndex];
+      final bufferId = _completionBufferIds[completionIndex];
+      final result = _completionResults[completionIndex];
+      final flags = _completionFlags[completionIndex];
+      var event = _completionEvents[completionIndex];
+      if (_workerPointer.ref.trace) print(TransportMessages.workerTrace(id, result, bufferId, event, fd));
 
       if (event & transportEventClient != 0) {
         event &= ~transportEventClient;
@@ -151,21 +206,21 @@ class TransportWorker {
           _clientRegistry.get(fd)?.notifyConnect(fd, result);
           continue;
         }
-        _clientRegistry.get(fd)?.notifyData(bufferId, result, event);
+        _clientRegistry.get(fd)?.notifyData(bufferId, result, event, flags);
         continue;
       }
 
       if (event & transportEventServer != 0) {
         event &= ~transportEventServer;
-        if (event == transportEventRead || event == transportEventWrite) {
-          _serverRegistry.getConnection(fd)?.notify(bufferId, result, event);
+        if (event == transportEventRead || event == transportEventWrite || event == transportEventReadMultishot || event == transportEventSplice) {
+          _serverRegistry.getConnection(fd)?.notify(bufferId, result, event, flags);
           continue;
         }
         if (event == transportEventReceiveMessage || event == transportEventSendMessage) {
-          _serverRegistry.getServer(fd)?.notifyDatagram(bufferId, result, event);
+          _serverRegistry.getServer(fd)?.notifyDatagram(bufferId, result, event, flags);
           continue;
         }
-        _serverRegistry.getServer(fd)?.notifyAccept(result);
+        _serverRegistry.getServer(fd)?.notifyAccept(result, flags);
         continue;
       }
 
@@ -173,8 +228,12 @@ class TransportWorker {
         _filesRegistry.get(fd)?.notify(bufferId, result, event & ~transportEventFile);
         continue;
       }
+
+      if (event == transportEventSplice) {
+        _proxyRegistry.get(bufferId)?.notify(bufferId, result);
+        continue;
+      }
     }
-    _bindings.transport_cqe_advance(_ring, cqeCount);
     return true;
   }
 
@@ -201,3 +201,49 @@ void testBuffersOverflow() {
     await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
   });
 }
+
+void testBuffersFairness() {
+  test("(fairness)", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker().copyWith(buffersCount: 2)));
+    await worker.initialize();
+    final buffers = worker.buffers;
+
+    final first = buffers.get()!;
+    final second = buffers.get()!;
+    final order = <String>[];
+    Future<int> waiter(String name, {bool priority = false}) => buffers.allocate(priority: priority).then((bufferId) {
+          order.add(name);
+          return bufferId;
+        });
+    final firstWaiter = waiter("first");
+    final secondWaiter = waiter("second");
+    final priorityWaiter = waiter("priority", priority: true);
+    expect(buffers.waiting(), 3);
+    expect(buffers.get(), isNull);
+
+    buffers.release(first);
+    buffers.release(second);
+    final served = await Future.wait([priorityWaiter, firstWaiter]);
+    expect(order, ["priority", "first"]);
+    buffers.release(served[0]);
+    final last = await secondWaiter;
+    expect(order, ["priority", "first", "second"]);
+    buffers.release(served[1]);
+    buffers.release(last);
+
+    final quota = buffers.quota(limit: 1);
+    final held = buffers.get(quota: quota)!;
+    expect(buffers.get(quota: quota), isNull);
+    final parked = buffers.allocate(quota: quota);
+    buffers.release(held);
+    buffers.release(await parked);
+    buffers.dispose(quota);
+
+    final waits = buffers.waits();
+    expect(waits.depth, 0);
+    expect(waits.count, 4);
+    if (worker.buffers.used() != 0) throw TestFailure("actual: ${worker.buffers.used()}");
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
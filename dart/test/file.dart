@@ -1,5 +1,6 @@
 import 'dart:async';
 import 'dart:io';
+import 'dart:typed_data';
 
 import 'package:iouring_transport/transport/defaults.dart';
 import 'package:iouring_transport/transport/transport.dart';
@@ -9,10 +10,10 @@ import 'package:test/test.dart';
 import 'generators.dart';
 import 'validators.dart';
 
-void testFileSingle({required int index}) {
-  test("(single) [index = $index]", () async {
+void testFileSingle({required int index, int registeredFilesCount = 0}) {
+  test("(single) [index = $index, registered files = $registeredFilesCount]", () async {
     final transport = Transport();
-    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker().copyWith(registeredFilesCount: registeredFilesCount)));
     await worker.initialize();
     var nativeFile = File("file-${worker.id}");
     if (nativeFile.existsSync()) nativeFile.deleteSync();
@@ -47,3 +48,24 @@ void testFileLoad({required int index, required int count}) {
     await transport.shutdown();
   });
 }
+
+void testFileVector({required int index, required int count}) {
+  test("(vector) [index = $index, count = $count]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    var nativeFile = File("file-${worker.id}");
+    if (nativeFile.existsSync()) nativeFile.deleteSync();
+    if (!nativeFile.existsSync()) nativeFile.createSync();
+    final file = worker.files.open(nativeFile.path, create: true);
+    final bufferSize = TransportDefaults.worker().bufferSize;
+    final data = List.generate(count, (index) => Uint8List(bufferSize)..fillRange(0, bufferSize, index + 1));
+    final completer = Completer();
+    file.writeMany(data, onDone: completer.complete, onError: completer.completeError);
+    await completer.future;
+    expect(await file.load(), data.expand((block) => block).toList());
+    await file.close();
+    if (nativeFile.existsSync()) nativeFile.deleteSync();
+    await transport.shutdown();
+  });
+}
@@ -1,7 +1,11 @@
 import 'dart:io' as io;
 import 'dart:typed_data';
 
+import 'package:iouring_transport/transport/configuration.dart';
+import 'package:iouring_transport/transport/constants.dart';
 import 'package:iouring_transport/transport/defaults.dart';
+import 'package:iouring_transport/transport/server/provider.dart';
+import 'package:iouring_transport/transport/server/server.dart';
 import 'package:iouring_transport/transport/transport.dart';
 import 'package:iouring_transport/transport/worker.dart';
 import 'package:test/test.dart';
@@ -10,10 +14,30 @@ import 'generators.dart';
 import 'latch.dart';
 import 'validators.dart';
 
-void testTcpSingle({required int index, required int clientsPool}) {
-  test("(single) [clients = $clientsPool]", () async {
+void testTcpSingle({
+  required int index,
+  required int clientsPool,
+  bool multishotAccept = false,
+  int providedBuffersCount = 0,
+  int registeredFilesCount = 0,
+  int? zeroCopySendThreshold,
+  bool eventfdWakeups = false,
+  bool ioThread = false,
+  bool hugePages = false,
+  bool zeroBuffers = true,
+}) {
+  test(
+      "(single) [clients = $clientsPool, multishot accept = $multishotAccept, provided buffers = $providedBuffersCount, registered files = $registeredFilesCount, zero copy threshold = $zeroCopySendThreshold, eventfd wakeups = $eventfdWakeups, io thread = $ioThread, huge pages = $hugePages, zero buffers = $zeroBuffers]",
+      () async {
     final transport = Transport();
-    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker().copyWith(
+          providedBuffersCount: providedBuffersCount,
+          registeredFilesCount: registeredFilesCount,
+          eventfdWakeups: eventfdWakeups,
+          ioThread: ioThread,
+          hugePages: hugePages,
+          zeroBuffers: zeroBuffers,
+        )));
     await worker.initialize();
     worker.servers.tcp(
       io.InternetAddress("0.0.0.0"),
@@ -24,8 +48,9 @@ void testTcpSingle({required int index, required int clientsPool}) {
           connection.writeSingle(Generators.response());
         },
       ),
+      configuration: TransportDefaults.tcpServer().copyWith(multishotAccept: multishotAccept, zeroCopySendThreshold: zeroCopySendThreshold),
     );
-    final clients = await worker.clients.tcp(io.InternetAddress("127.0.0.1"), 12345, configuration: TransportDefaults.tcpClient().copyWith(pool: clientsPool));
+    final clients = await worker.clients.tcp(io.InternetAddress("127.0.0.1"), 12345, configuration: TransportDefaults.tcpClient().copyWith(pool: clientsPool, zeroCopySendThreshold: zeroCopySendThreshold));
     final latch = Latch(clientsPool);
     clients.forEach((client) {
       client.writeSingle(Generators.request());
@@ -39,10 +64,26 @@ void testTcpSingle({required int index, required int clientsPool}) {
   });
 }
 
-void testTcpMany({required int index, required int clientsPool, required int count}) {
-  test("(many) [clients = $clientsPool, count = $count]", () async {
+void testTcpMany({
+  required int index,
+  required int clientsPool,
+  required int count,
+  int? ringSize,
+  List<TransportBufferClassConfiguration>? bufferClasses,
+  int? buffersCount,
+  int? maxBuffersCount,
+  bool wideTags = false,
+}) {
+  test("(many) [clients = $clientsPool, count = $count, ring size = $ringSize, buffer classes = ${bufferClasses?.length}, buffers = $buffersCount..$maxBuffersCount, wide tags = $wideTags]", () async {
     final transport = Transport();
-    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker().copyWith(
+          ringSize: ringSize,
+          bufferClasses: bufferClasses,
+          buffersCount: buffersCount,
+          maxBuffersCount: maxBuffersCount,
+          buffersGrowChunk: 64,
+          wideTags: wideTags,
+        )));
     await worker.initialize();
     worker.servers.tcp(
       io.InternetAddress("0.0.0.0"),
@@ -80,6 +121,324 @@ void testTcpMany({required int index, required int clientsPool, required int cou
       );
     });
     await latch.done();
+    if (maxBuffersCount != null) expect(worker.buffers.grows(), greaterThan(0));
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+Uint8List _frame(TransportFraming framing, Uint8List bytes) {
+  if (framing.mode == transportFramingDelimiter) return Uint8List.fromList([...bytes, framing.delimiter]);
+  final header = List.generate(framing.lengthSize, (index) => (bytes.length >> (8 * (framing.lengthSize - index - 1))) & 0xff);
+  return Uint8List.fromList([...header, ...bytes]);
+}
+
+void testTcpFraming({
+  required int index,
+  required int clientsPool,
+  required int count,
+  required TransportFraming framing,
+  bool ioThread = false,
+  bool emptyFrames = false,
+}) {
+  test("(framing) [clients = $clientsPool, count = $count, mode = ${framing.mode}, io thread = $ioThread, empty frames = $emptyFrames]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker().copyWith(ioThread: ioThread)));
+    await worker.initialize();
+    final empty = Latch(clientsPool * count);
+    worker.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12345,
+      (connection) => connection.stream().listen(
+        (event) {
+          final bytes = event.takeBytes();
+          if (bytes.isEmpty) {
+            empty.countDown();
+            return;
+          }
+          Validators.request(bytes);
+          connection.writeSingle(_frame(framing, Generators.response()));
+        },
+      ),
+      configuration: TransportDefaults.tcpServer().copyWith(framing: framing),
+    );
+    final clients = await worker.clients.tcp(io.InternetAddress("127.0.0.1"), 12345, configuration: TransportDefaults.tcpClient().copyWith(pool: clientsPool, framing: framing));
+    final latch = Latch(clientsPool * count);
+    clients.forEach((client) {
+      final stream = Uint8List.fromList(List.generate(count, (_) => [if (emptyFrames) ..._frame(framing, Uint8List(0)), ..._frame(framing, Generators.request())]).expand((frame) => frame).toList());
+      client.writeSingle(Uint8List.sublistView(stream, 0, stream.length ~/ 3));
+      client.writeSingle(Uint8List.sublistView(stream, stream.length ~/ 3));
+      client.stream().listen((value) {
+        Validators.response(value.takeBytes());
+        latch.countDown();
+      });
+    });
+    await latch.done();
+    if (emptyFrames) await empty.done();
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testTcpSendFile({
+  required int index,
+  required int clientsPool,
+  required int size,
+  int chunkSize = transportSpliceChunkSize,
+  bool ioThread = false,
+}) {
+  test("(send file) [clients = $clientsPool, size = $size, chunk = $chunkSize, io thread = $ioThread]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker().copyWith(ioThread: ioThread)));
+    await worker.initialize();
+    final nativeFile = io.File("file-send-${worker.id}");
+    final content = Uint8List.fromList(List.generate(size, (index) => index & 0xff));
+    nativeFile.writeAsBytesSync(content);
+    final file = worker.files.open(nativeFile.path);
+    worker.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12345,
+      (connection) => connection.stream().listen(
+        (event) {
+          Validators.request(event.takeBytes());
+          var sent = 0;
+          connection.sendFile(
+            file,
+            chunkSize: chunkSize,
+            onProgress: (bytes) => sent += bytes,
+            onDone: () => expect(sent, size),
+            onError: (error) => fail(error.toString()),
+          );
+        },
+      ),
+    );
+    final clients = await worker.clients.tcp(io.InternetAddress("127.0.0.1"), 12345, configuration: TransportDefaults.tcpClient().copyWith(pool: clientsPool));
+    final latch = Latch(clientsPool);
+    clients.forEach((client) {
+      final received = BytesBuilder();
+      client.writeSingle(Generators.request());
+      client.stream().listen((value) {
+        received.add(value.takeBytes());
+        if (received.length < size) return;
+        expect(received.takeBytes(), content);
+        latch.countDown();
+      });
+    });
+    await latch.done();
+    await file.close();
+    if (nativeFile.existsSync()) nativeFile.deleteSync();
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testTcpProxy({
+  required int index,
+  required int clientsPool,
+  bool ioThread = false,
+}) {
+  test("(proxy) [clients = $clientsPool, io thread = $ioThread]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker().copyWith(ioThread: ioThread, splicePipesCount: clientsPool * 2)));
+    await worker.initialize();
+    worker.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12346,
+      (connection) => connection.stream().listen(
+        (event) {
+          Validators.request(event.takeBytes());
+          connection.writeSingle(Generators.response());
+        },
+      ),
+    );
+    final proxies = Latch(clientsPool);
+    worker.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12345,
+      (connection) async {
+        final upstream = await worker.clients.tcp(io.InternetAddress("127.0.0.1"), 12346);
+        worker.proxies.open(
+          connection,
+          upstream.select(),
+          onClose: proxies.countDown,
+          onError: (error) => fail(error.toString()),
+        );
+      },
+    );
+    final clients = await worker.clients.tcp(io.InternetAddress("127.0.0.1"), 12345, configuration: TransportDefaults.tcpClient().copyWith(pool: clientsPool));
+    final latch = Latch(clientsPool);
+    clients.forEach((client) {
+      final received = BytesBuilder();
+      client.writeSingle(Generators.request());
+      client.stream().listen((value) {
+        received.add(value.takeBytes());
+        if (received.length < Generators.response().length) return;
+        Validators.response(received.takeBytes());
+        latch.countDown();
+      });
+    });
+    await latch.done();
+    await clients.close();
+    await proxies.done();
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testTcpCoalesced({
+  required int index,
+  required int clientsPool,
+  required int count,
+  required int coalesceThreshold,
+}) {
+  test("(coalesced) [clients = $clientsPool, count = $count, threshold = $coalesceThreshold]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    final writes = Latch(clientsPool * count);
+    worker.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12345,
+      (connection) => connection.stream().listen(
+        (event) {
+          Validators.request(event.takeBytes());
+          for (var response in Generators.responsesOrdered(count)) {
+            connection.writeSingle(
+              response,
+              onDone: writes.countDown,
+              onError: (error) => fail(error.toString()),
+            );
+          }
+        },
+      ),
+      configuration: TransportDefaults.tcpServer().copyWith(coalesceThreshold: coalesceThreshold),
+    );
+    final clients = await worker.clients.tcp(io.InternetAddress("127.0.0.1"), 12345, configuration: TransportDefaults.tcpClient().copyWith(pool: clientsPool));
+    final expected = Generators.responsesSumOrdered(count);
+    final latch = Latch(clientsPool);
+    clients.forEach((client) {
+      final received = BytesBuilder();
+      client.writeSingle(Generators.request());
+      client.stream().listen((value) {
+        received.add(value.takeBytes());
+        if (received.length < expected.length) return;
+        Validators.responsesSumOrdered(received.takeBytes(), count);
+        latch.countDown();
+      });
+    });
+    await latch.done();
+    await writes.done();
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testTcpBatches({
+  required int index,
+  required int clientsPool,
+  required int count,
+  bool ioThread = false,
+}) {
+  test("(batches) [clients = $clientsPool, count = $count, io thread = $ioThread]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker().copyWith(ioThread: ioThread)));
+    await worker.initialize();
+    final expected = Generators.requestsSumOrdered(count);
+    worker.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12345,
+      (connection) {
+        final received = BytesBuilder();
+        connection.batches().listen((batch) {
+          for (var payload in batch) received.add(payload.takeBytes());
+          if (received.length < expected.length) return;
+          Validators.requestsSumOrdered(received.takeBytes(), count);
+          connection.writeSingle(Generators.response());
+        });
+      },
+    );
+    final clients = await worker.clients.tcp(io.InternetAddress("127.0.0.1"), 12345, configuration: TransportDefaults.tcpClient().copyWith(pool: clientsPool));
+    final latch = Latch(clientsPool);
+    clients.forEach((client) {
+      client.batches().listen((batch) {
+        Validators.response(batch.single.takeBytes());
+        latch.countDown();
+      });
+      for (var request in Generators.requestsOrdered(count)) {
+        client.writeSingle(request);
+      }
+    });
+    await latch.done();
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testTcpLease({
+  required int index,
+  required int clientsPool,
+}) {
+  test("(lease) [clients = $clientsPool]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    await worker.initialize();
+    worker.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12345,
+      (connection) => connection.stream().listen((event) => connection.forward(event, onError: (error) => fail(error.toString()))),
+    );
+    final clients = await worker.clients.tcp(io.InternetAddress("127.0.0.1"), 12345, configuration: TransportDefaults.tcpClient().copyWith(pool: clientsPool));
+    final latch = Latch(clientsPool);
+    final request = Generators.request();
+    for (var client in clients.clients) {
+      client.stream().listen((value) {
+        Validators.request(value.takeBytes());
+        latch.countDown();
+      });
+      final lease = await client.lease(size: request.length);
+      expect(lease.capacity, greaterThanOrEqualTo(request.length));
+      lease.bytes.setAll(0, request);
+      client.writeLease(lease, request.length);
+      expect(lease.active, isFalse);
+    }
+    await latch.done();
+    await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
+  });
+}
+
+void testTcpBroadcast({
+  required int index,
+  required int clientsPool,
+  bool wideTags = false,
+}) {
+  test("(broadcast) [clients = $clientsPool, wide tags = $wideTags]", () async {
+    final transport = Transport();
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker().copyWith(wideTags: wideTags)));
+    await worker.initialize();
+    final connections = <TransportServerConnection>[];
+    final delivered = Latch(clientsPool);
+    late final TransportServer server;
+    server = worker.servers.tcp(
+      io.InternetAddress("0.0.0.0"),
+      12345,
+      (connection) => connection.stream().listen((event) {
+        Validators.request(event.takeBytes());
+        connections.add(connection);
+        if (connections.length == clientsPool) {
+          server.broadcast(
+            Generators.response(),
+            connections,
+            onError: (connection, error) => fail(error.toString()),
+            onDone: (connection) => delivered.countDown(),
+          );
+        }
+      }),
+    );
+    final clients = await worker.clients.tcp(io.InternetAddress("127.0.0.1"), 12345, configuration: TransportDefaults.tcpClient().copyWith(pool: clientsPool));
+    final latch = Latch(clientsPool);
+    for (var client in clients.clients) {
+      client.stream().listen((value) {
+        Validators.response(value.takeBytes());
+        latch.countDown();
+      });
+      client.writeSingle(Generators.request());
+    }
+    await latch.done();
+    await delivered.done();
     await transport.shutdown(gracefulTimeout: Duration(milliseconds: 100));
   });
 }
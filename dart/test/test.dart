@@ -1,3 +1,4 @@
+import 'package:iouring_transport/transport/configuration.dart';
 import 'package:iouring_transport/transport/defaults.dart';
 import 'package:iouring_transport/transport/transport.dart';
 import 'package:iouring_transport/transport/worker.dart';
@@ -36,9 +37,37 @@ void main() {
       testTcpSingle(index: index, clientsPool: 1);
       testTcpSingle(index: index, clientsPool: 128);
       testTcpSingle(index: index, clientsPool: 512);
+      testTcpSingle(index: index, clientsPool: 512, multishotAccept: true);
+      testTcpSingle(index: index, clientsPool: 512, providedBuffersCount: 1024);
+      testTcpSingle(index: index, clientsPool: 128, zeroCopySendThreshold: 0);
+      testTcpSingle(index: index, clientsPool: 512, registeredFilesCount: 16384);
+      testTcpSingle(index: index, clientsPool: 128, eventfdWakeups: true);
+      testTcpSingle(index: index, clientsPool: 128, ioThread: true);
+      testTcpSingle(index: index, clientsPool: 128, hugePages: true, zeroBuffers: false);
       testTcpMany(index: index, clientsPool: 1, count: 64);
       testTcpMany(index: index, clientsPool: 128, count: 8);
       testTcpMany(index: index, clientsPool: 512, count: 4);
+      testTcpMany(index: index, clientsPool: 128, count: 8, ringSize: 64);
+      testTcpMany(index: index, clientsPool: 128, count: 8, bufferClasses: [TransportBufferClassConfiguration(size: 64, count: 1024), TransportBufferClassConfiguration(size: 16384, count: 256)]);
+      testTcpMany(index: index, clientsPool: 128, count: 8, buffersCount: 64, maxBuffersCount: 4096);
+      testTcpMany(index: index, clientsPool: 128, count: 8, buffersCount: 70000, wideTags: true);
+      testTcpFraming(index: index, clientsPool: 128, count: 8, framing: TransportFraming.lengthPrefix(maxFrameSize: 4096));
+      testTcpFraming(index: index, clientsPool: 128, count: 8, framing: TransportFraming.lengthPrefix(lengthSize: 2, maxFrameSize: 4096), ioThread: true);
+      testTcpFraming(index: index, clientsPool: 128, count: 8, framing: TransportFraming.delimiter(maxFrameSize: 4096));
+      testTcpFraming(index: index, clientsPool: 8, count: 8, framing: TransportFraming.lengthPrefix(maxFrameSize: 4096), emptyFrames: true);
+      testTcpFraming(index: index, clientsPool: 8, count: 8, framing: TransportFraming.delimiter(maxFrameSize: 4096), emptyFrames: true);
+      testTcpSendFile(index: index, clientsPool: 1, size: 1024 * 1024 + 17);
+      testTcpSendFile(index: index, clientsPool: 8, size: 300000, chunkSize: 4096, ioThread: true);
+      testTcpProxy(index: index, clientsPool: 1);
+      testTcpProxy(index: index, clientsPool: 8, ioThread: true);
+      testTcpCoalesced(index: index, clientsPool: 1, count: 16, coalesceThreshold: 4096);
+      testTcpCoalesced(index: index, clientsPool: 8, count: 64, coalesceThreshold: 64);
+      testTcpBatches(index: index, clientsPool: 1, count: 32);
+      testTcpBatches(index: index, clientsPool: 8, count: 32, ioThread: true);
+      testTcpLease(index: index, clientsPool: 1);
+      testTcpLease(index: index, clientsPool: 8);
+      testTcpBroadcast(index: index, clientsPool: 8);
+      testTcpBroadcast(index: index, clientsPool: 8, wideTags: true);
     }
   });
   group("[unix stream]", timeout: Timeout(Duration(hours: 1)), skip: !unixStream, () {
@@ -58,6 +87,7 @@ void main() {
       testUdpSingle(index: index, clients: 1);
       testUdpSingle(index: index, clients: 128);
       testUdpSingle(index: index, clients: 512);
+      testUdpSingle(index: index, clients: 128, zeroCopySendThreshold: 0);
       testUdpMany(index: index, clients: 1, count: 64);
       testUdpMany(index: index, clients: 128, count: 8);
       testUdpMany(index: index, clients: 512, count: 4);
@@ -67,20 +97,27 @@ void main() {
     final testsCount = 5;
     for (var index = 0; index < testsCount; index++) {
       testFileSingle(index: index);
+      testFileSingle(index: index, registeredFilesCount: 1024);
       testFileLoad(index: index, count: 1);
       testFileLoad(index: index, count: 8);
       testFileLoad(index: index, count: 16);
+      testFileVector(index: index, count: 8);
     }
   });
   group("[timeout]", timeout: Timeout(Duration(hours: 1)), skip: !timeout, () {
     testTcpTimeout(connection: Duration(seconds: 1), serverRead: Duration(seconds: 5), clientRead: Duration(seconds: 3));
     testUdpTimeout(serverRead: Duration(seconds: 5), clientRead: Duration(seconds: 3));
+    testTcpTimeout(connection: Duration(milliseconds: 500), serverRead: Duration(milliseconds: 1500), clientRead: Duration(milliseconds: 750));
+    testUdpTimeout(serverRead: Duration(milliseconds: 1500), clientRead: Duration(milliseconds: 750));
+    testTcpTimeout(connection: Duration(milliseconds: 500), serverRead: Duration(milliseconds: 1500), clientRead: Duration(milliseconds: 750), linkTimeouts: true);
+    testUdpTimeout(serverRead: Duration(milliseconds: 1500), clientRead: Duration(milliseconds: 750), linkTimeouts: true);
   });
   group("[buffers]", timeout: Timeout(Duration(hours: 1)), skip: !buffers, () {
     testTcpBuffers();
     testUdpBuffers();
     testFileBuffers();
     testBuffersOverflow();
+    testBuffersFairness();
   });
   group("[bulk]", timeout: Timeout(Duration(hours: 1)), skip: !bulk, () {
     testBulk();
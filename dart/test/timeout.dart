@@ -9,15 +9,15 @@ import 'package:test/test.dart';
 
 Function _handleTimeout(Stopwatch actual, Duration expected, Completer completer) => (error) {
       if (!(error is TransportCanceledException)) throw TestFailure("actual: $error");
-      if (actual.elapsed.inSeconds < expected.inSeconds) throw TestFailure("actual: ${actual.elapsed.inSeconds}");
+      if (actual.elapsed.inMilliseconds < expected.inMilliseconds) throw TestFailure("actual: ${actual.elapsed.inMilliseconds}");
       completer.complete();
       return null;
     };
 
-void testTcpTimeout({required Duration connection, required Duration serverRead, required Duration clientRead}) {
-  test("(timeout tcp single) [connection = ${connection.inSeconds}, serverRead = ${serverRead.inSeconds}, clientRead = ${clientRead.inSeconds}] ", () async {
+void testTcpTimeout({required Duration connection, required Duration serverRead, required Duration clientRead, bool linkTimeouts = false}) {
+  test("(timeout tcp single) [connection = ${connection.inMilliseconds}, serverRead = ${serverRead.inMilliseconds}, clientRead = ${clientRead.inMilliseconds}, link timeouts = $linkTimeouts] ", () async {
     final transport = Transport();
-    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker().copyWith(linkTimeouts: linkTimeouts)));
     await worker.initialize();
 
     final time = Stopwatch();
@@ -53,10 +53,10 @@ void testTcpTimeout({required Duration connection, required Duration serverRead,
   });
 }
 
-void testUdpTimeout({required Duration serverRead, required Duration clientRead}) {
-  test("(timeout udp single) [serverRead = ${serverRead.inSeconds}, clientRead = ${clientRead.inSeconds}] ", () async {
+void testUdpTimeout({required Duration serverRead, required Duration clientRead, bool linkTimeouts = false}) {
+  test("(timeout udp single) [serverRead = ${serverRead.inMilliseconds}, clientRead = ${clientRead.inMilliseconds}, link timeouts = $linkTimeouts] ", () async {
     final transport = Transport();
-    final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
+    final worker = TransportWorker(transport.worker(TransportDefaults.worker().copyWith(linkTimeouts: linkTimeouts)));
     await worker.initialize();
 
     final time = Stopwatch();
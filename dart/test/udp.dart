@@ -11,12 +11,19 @@ import 'generators.dart';
 import 'latch.dart';
 import 'validators.dart';
 
-void testUdpSingle({required int index, required int clients}) {
-  test("(single) [clients = $clients]", () async {
+void testUdpSingle({required int index, required int clients, int? zeroCopySendThreshold}) {
+  test("(single) [clients = $clients, zero copy threshold = $zeroCopySendThreshold]", () async {
     final transport = Transport();
     final worker = TransportWorker(transport.worker(TransportDefaults.worker()));
     await worker.initialize();
-    worker.servers.udp(io.InternetAddress("0.0.0.0"), 12345).stream().listen(
+    worker.servers
+        .udp(
+          io.InternetAddress("0.0.0.0"),
+          12345,
+          configuration: TransportDefaults.udpServer().copyWith(zeroCopySendThreshold: zeroCopySendThreshold),
+        )
+        .stream()
+        .listen(
       (event) {
         Validators.request(event.takeBytes());
         event.respondSingle(Generators.response());
@@ -24,7 +31,13 @@ void testUdpSingle({required int index, required int clients}) {
     );
     final latch = Latch(clients);
     for (var clientIndex = 0; clientIndex < clients; clientIndex++) {
-      final client = worker.clients.udp(io.InternetAddress("127.0.0.1"), (worker.id + 1) * 2000 + (clientIndex + 1), io.InternetAddress("127.0.0.1"), 12345);
+      final client = worker.clients.udp(
+        io.InternetAddress("127.0.0.1"),
+        (worker.id + 1) * 2000 + (clientIndex + 1),
+        io.InternetAddress("127.0.0.1"),
+        12345,
+        configuration: TransportDefaults.udpClient().copyWith(zeroCopySendThreshold: zeroCopySendThreshold),
+      );
       client.stream().listen((event) {
         Validators.response(event.takeBytes());
         latch.countDown();
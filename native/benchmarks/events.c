@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <time.h>
+#include "transport_collections.h"
+#include "transport_events.h"
+
+#define TRANSPORT_BENCHMARK_WINDOW 65535
+#define TRANSPORT_BENCHMARK_DESCRIPTORS 1024
+
+static inline uint64_t transport_benchmark_now()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+static inline uint64_t transport_benchmark_data(uint32_t operation, uint32_t window)
+{
+    uint64_t fd = operation % TRANSPORT_BENCHMARK_DESCRIPTORS + 3;
+    uint64_t buffer_id = operation % window;
+    return (fd << 32) | (buffer_id << 16) | TRANSPORT_EVENT_READ;
+}
+
+static uint64_t transport_benchmark_mhash(uint32_t count, uint32_t window)
+{
+    struct mh_events_t* events = mh_events_new();
+    mh_events_reserve(events, window, 0);
+    uint64_t found = 0;
+    uint64_t started = transport_benchmark_now();
+    for (uint32_t operation = 0; operation < count; operation++)
+    {
+        if (operation >= window)
+        {
+            mh_int_t event = mh_events_find(events, transport_benchmark_data(operation - window, window), 0);
+            if (event != mh_end(events))
+            {
+                mh_events_del(events, event, 0);
+            }
+        }
+        uint64_t data = transport_benchmark_data(operation, window);
+        struct mh_events_node_t node = {
+            .data = data,
+            .timeout = operation,
+            .link = operation,
+        };
+        mh_events_put(events, &node, NULL, 0);
+        found += mh_events_find(events, data, 0) != mh_end(events);
+    }
+    uint64_t elapsed = transport_benchmark_now() - started;
+    mh_events_delete(events);
+    return found == count ? elapsed : 0;
+}
+
+static uint64_t transport_benchmark_table(uint32_t count, uint32_t window)
+{
+    struct transport_events events;
+    transport_events_create(&events, window, TRANSPORT_BENCHMARK_DESCRIPTORS);
+    uint64_t found = 0;
+    uint64_t started = transport_benchmark_now();
+    for (uint32_t operation = 0; operation < count; operation++)
+    {
+        if (operation >= window)
+        {
+            struct transport_event* event = transport_events_find(&events, transport_benchmark_data(operation - window, window));
+            if (event)
+            {
+                transport_events_remove(event);
+            }
+        }
+        uint64_t data = transport_benchmark_data(operation, window);
+        struct transport_event* event = transport_events_slot(&events, data);
+        event->data = data;
+        event->timeout = operation;
+        event->link = operation;
+        found += transport_events_find(&events, data) != NULL;
+    }
+    uint64_t elapsed = transport_benchmark_now() - started;
+    transport_events_destroy(&events);
+    return found == count ? elapsed : 0;
+}
+
+int main()
+{
+    uint32_t counts[] = {1 << 10, 1 << 16, 1 << 20};
+    printf("%-10s %-10s %-16s %-16s\n", "operations", "in flight", "mhash ns/op", "table ns/op");
+    for (size_t index = 0; index < sizeof(counts) / sizeof(counts[0]); index++)
+    {
+        uint32_t count = counts[index];
+        uint32_t window = count < TRANSPORT_BENCHMARK_WINDOW ? count : TRANSPORT_BENCHMARK_WINDOW;
+        uint64_t mhash = transport_benchmark_mhash(count, window);
+        uint64_t table = transport_benchmark_table(count, window);
+        printf("%-10u %-10u %-16.2f %-16.2f\n", count, window, (double)mhash / count, (double)table / count);
+    }
+    return 0;
+}
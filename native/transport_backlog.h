@@ -0,0 +1,108 @@
+#ifndef TRANSPORT_BACKLOG_H
+#define TRANSPORT_BACKLOG_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "common/common.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+    struct transport_backlog
+    {
+        uint8_t* elements;
+        uint32_t element_size;
+        uint32_t capacity;
+        uint32_t head;
+        uint32_t count;
+    };
+
+    static inline int transport_backlog_create(struct transport_backlog* backlog, uint32_t capacity, uint32_t element_size)
+    {
+        uint32_t size = 1;
+        while (size < capacity)
+        {
+            size <<= 1;
+        }
+        backlog->elements = (uint8_t*)malloc((size_t)size * element_size);
+        if (backlog->elements == NULL)
+        {
+            return -1;
+        }
+        backlog->element_size = element_size;
+        backlog->capacity = size;
+        backlog->head = 0;
+        backlog->count = 0;
+        return 0;
+    }
+
+    static inline void transport_backlog_destroy(struct transport_backlog* backlog)
+    {
+        free(backlog->elements);
+        backlog->elements = NULL;
+    }
+
+    static inline int transport_backlog_grow(struct transport_backlog* backlog)
+    {
+        uint32_t capacity = backlog->capacity << 1;
+        uint8_t* elements = (uint8_t*)malloc((size_t)capacity * backlog->element_size);
+        if (elements == NULL)
+        {
+            return -1;
+        }
+        uint32_t first = backlog->capacity - backlog->head;
+        if (first > backlog->count)
+        {
+            first = backlog->count;
+        }
+        memcpy(elements, backlog->elements + (size_t)backlog->head * backlog->element_size, (size_t)first * backlog->element_size);
+        memcpy(elements + (size_t)first * backlog->element_size, backlog->elements, (size_t)(backlog->count - first) * backlog->element_size);
+        free(backlog->elements);
+        backlog->elements = elements;
+        backlog->capacity = capacity;
+        backlog->head = 0;
+        return 0;
+    }
+
+    static inline int transport_backlog_push(struct transport_backlog* backlog, const void* element)
+    {
+        if (unlikely(backlog->count == backlog->capacity) && transport_backlog_grow(backlog))
+        {
+            return -1;
+        }
+        uint32_t tail = (backlog->head + backlog->count) & (backlog->capacity - 1);
+        memcpy(backlog->elements + (size_t)tail * backlog->element_size, element, backlog->element_size);
+        backlog->count++;
+        return 0;
+    }
+
+    static inline void* transport_backlog_peek(struct transport_backlog* backlog)
+    {
+        if (backlog->count == 0)
+        {
+            return NULL;
+        }
+        return backlog->elements + (size_t)backlog->head * backlog->element_size;
+    }
+
+    static inline void* transport_backlog_at(struct transport_backlog* backlog, uint32_t index)
+    {
+        return backlog->elements + (size_t)((backlog->head + index) & (backlog->capacity - 1)) * backlog->element_size;
+    }
+
+    static inline void transport_backlog_pop(struct transport_backlog* backlog)
+    {
+        backlog->head = (backlog->head + 1) & (backlog->capacity - 1);
+        backlog->count--;
+    }
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
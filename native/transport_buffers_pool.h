@@ -1,6 +1,7 @@
 #ifndef TRANSPORT_BUFFERS_POOL_INCLUDED
 #define TRANSPORT_BUFFERS_POOL_INCLUDED
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -15,6 +16,22 @@ struct transport_buffers_pool
     size_t size;
 };
 
+struct transport_buffers_class
+{
+    uint32_t size;
+    uint32_t first;
+    uint32_t count;
+    struct transport_buffers_pool free_buffers;
+};
+
+struct transport_buffers_chunk
+{
+    void* memory;
+    size_t size;
+    uint32_t first;
+    uint32_t count;
+};
+
 static inline int transport_buffers_pool_create(struct transport_buffers_pool* pool, size_t size)
 {
     pool->size = size;
@@ -35,6 +52,51 @@ static inline void transport_buffers_pool_push(struct transport_buffers_pool* po
     pool->ids[pool->count++] = id;
 }
 
+static inline size_t transport_buffers_pool_count_from(struct transport_buffers_pool* pool, int32_t first)
+{
+    size_t count = 0;
+    for (size_t index = 0; index < pool->count; index++)
+    {
+        count += pool->ids[index] >= first;
+    }
+    return count;
+}
+
+static inline void transport_buffers_pool_remove_from(struct transport_buffers_pool* pool, int32_t first)
+{
+    size_t count = 0;
+    for (size_t index = 0; index < pool->count; index++)
+    {
+        if (pool->ids[index] < first)
+        {
+            pool->ids[count++] = pool->ids[index];
+        }
+    }
+    pool->count = count;
+}
+
+static inline int transport_buffers_references_create(uint32_t** references, size_t size)
+{
+    *references = (uint32_t*)calloc(size, sizeof(uint32_t));
+    return (*references == NULL ? -1 : 0);
+}
+
+static inline void transport_buffers_share(uint32_t* references, uint32_t id, uint32_t count)
+{
+    references[id] = count;
+}
+
+static inline bool transport_buffers_unreference(uint32_t* references, uint32_t id)
+{
+    if (likely(references[id] <= 1))
+    {
+        references[id] = 0;
+        return true;
+    }
+    references[id]--;
+    return false;
+}
+
 static inline int32_t transport_buffers_pool_pop(struct transport_buffers_pool* pool)
 {
     if (unlikely(pool->count == 0))
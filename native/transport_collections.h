@@ -13,9 +13,8 @@ extern "C"
   struct mh_events_node_t
   {
     mh_key_t data;
-    int64_t timeout;
-    uint64_t timestamp;
-    int fd;
+    uint32_t timeout;
+    uint32_t link;
   };
 
 #define mh_node_t struct mh_events_node_t
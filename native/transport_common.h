@@ -12,11 +12,13 @@ extern "C"
     static inline struct io_uring_sqe* transport_provide_sqe(struct io_uring* ring)
     {
         struct io_uring_sqe* sqe = io_uring_get_sqe(ring);
-        while (unlikely(sqe == NULL))
+        if (unlikely(sqe == NULL))
         {
-            struct io_uring_cqe* unused;
-            io_uring_wait_cqe_nr(ring, &unused, 1);
-            sqe = io_uring_get_sqe(ring);
+            io_uring_submit(ring);
+            while (unlikely((sqe = io_uring_get_sqe(ring)) == NULL))
+            {
+                io_uring_submit_and_wait(ring, 1);
+            }
         }
         return sqe;
     };
@@ -15,6 +15,15 @@ extern "C"
 #define TRANSPORT_EVENT_CLIENT ((uint16_t)1 << 6)
 #define TRANSPORT_EVENT_FILE ((uint16_t)1 << 7)
 #define TRANSPORT_EVENT_SERVER ((uint16_t)1 << 8)
+#define TRANSPORT_EVENT_READ_MULTISHOT ((uint16_t)1 << 9)
+#define TRANSPORT_EVENT_LINK_TIMEOUT ((uint16_t)1 << 10)
+#define TRANSPORT_EVENT_WAKEUP ((uint16_t)1 << 11)
+#define TRANSPORT_EVENT_VECTOR ((uint16_t)1 << 12)
+#define TRANSPORT_EVENT_FRAME ((uint16_t)1 << 13)
+#define TRANSPORT_EVENT_SPLICE ((uint16_t)1 << 14)
+#define TRANSPORT_EVENT_SPLICE_INPUT ((uint16_t)1 << 15)
+#define TRANSPORT_EVENT_SPLICE_POLL TRANSPORT_EVENT_LINK_TIMEOUT
+#define TRANSPORT_EVENT_TIMEOUTS_TICK (TRANSPORT_EVENT_LINK_TIMEOUT | TRANSPORT_EVENT_WAKEUP)
 
 #define TRANSPORT_READ_ONLY (1 << 0)
 #define TRANSPORT_WRITE_ONLY (1 << 1)
@@ -24,6 +33,9 @@ extern "C"
 
 #define TRANSPORT_BUFFER_USED -1
 #define TRANSPORT_TIMEOUT_INFINITY -1
+#define TRANSPORT_PROVIDED_BUFFERS_GROUP 0
+#define TRANSPORT_BUFFER_CLASSES_MAX 8
+#define TRANSPORT_REGISTERED_BUFFERS_MAX (1 << 14)
 
 #define TRANSPORT_SOCKET_OPTION_SOCKET_NONBLOCK ((uint64_t)1 << 1)
 #define TRANSPORT_SOCKET_OPTION_SOCKET_CLOCEXEC ((uint64_t)1 << 2)
@@ -0,0 +1,148 @@
+#ifndef TRANSPORT_EVENTS_H
+#define TRANSPORT_EVENTS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "common/common.h"
+#include "transport_constants.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+#define TRANSPORT_EVENTS_EMPTY 0
+#define TRANSPORT_EVENTS_CACHE_LINE 64
+#define TRANSPORT_EVENTS_UNBUFFERED (TRANSPORT_EVENT_ACCEPT | TRANSPORT_EVENT_CONNECT | TRANSPORT_EVENT_READ_MULTISHOT | TRANSPORT_EVENT_SPLICE)
+#define TRANSPORT_EVENTS_DESCRIPTOR_KINDS 3
+#define TRANSPORT_EVENTS_SPLICE_KINDS 3
+
+    struct transport_event
+    {
+        uint64_t data;
+        uint32_t timeout;
+        uint32_t link;
+    };
+
+    struct transport_events
+    {
+        struct transport_event* buffers;
+        uint32_t buffers_count;
+        struct transport_event* descriptors;
+        uint32_t descriptors_capacity;
+        struct transport_event* splices;
+        uint32_t splices_count;
+    };
+
+    static inline int transport_events_create(struct transport_events* events, uint32_t buffers_count, uint32_t descriptors_capacity, uint32_t splices_count)
+    {
+        events->buffers_count = buffers_count ? buffers_count : 1;
+        events->descriptors_capacity = descriptors_capacity ? descriptors_capacity : 1;
+        events->splices_count = splices_count;
+        events->descriptors = (struct transport_event*)calloc((size_t)events->descriptors_capacity * TRANSPORT_EVENTS_DESCRIPTOR_KINDS, sizeof(struct transport_event));
+        events->splices = (struct transport_event*)calloc((size_t)(splices_count ? splices_count : 1) * TRANSPORT_EVENTS_SPLICE_KINDS, sizeof(struct transport_event));
+        if (posix_memalign((void**)&events->buffers, TRANSPORT_EVENTS_CACHE_LINE, events->buffers_count * sizeof(struct transport_event)) || events->descriptors == NULL ||
+            events->splices == NULL)
+        {
+            return -1;
+        }
+        memset(events->buffers, 0, events->buffers_count * sizeof(struct transport_event));
+        return 0;
+    }
+
+    static inline void transport_events_destroy(struct transport_events* events)
+    {
+        free(events->buffers);
+        free(events->descriptors);
+        free(events->splices);
+        events->buffers = NULL;
+        events->descriptors = NULL;
+        events->splices = NULL;
+    }
+
+    static inline bool transport_events_reserve_descriptors(struct transport_events* events, uint32_t fd)
+    {
+        if (likely(fd < events->descriptors_capacity))
+        {
+            return true;
+        }
+        uint32_t capacity = events->descriptors_capacity;
+        while (capacity <= fd)
+        {
+            capacity *= 2;
+        }
+        struct transport_event* descriptors = (struct transport_event*)realloc(events->descriptors, (size_t)capacity * TRANSPORT_EVENTS_DESCRIPTOR_KINDS * sizeof(struct transport_event));
+        if (descriptors == NULL)
+        {
+            return false;
+        }
+        memset(descriptors + (size_t)events->descriptors_capacity * TRANSPORT_EVENTS_DESCRIPTOR_KINDS,
+               0,
+               (size_t)(capacity - events->descriptors_capacity) * TRANSPORT_EVENTS_DESCRIPTOR_KINDS * sizeof(struct transport_event));
+        events->descriptors = descriptors;
+        events->descriptors_capacity = capacity;
+        return true;
+    }
+
+    static inline uint32_t transport_events_descriptor_kind(uint64_t data)
+    {
+        return data & TRANSPORT_EVENT_ACCEPT ? 0 : data & TRANSPORT_EVENT_CONNECT ? 1 : 2;
+    }
+
+    static inline struct transport_event* transport_events_splice(struct transport_events* events, uint64_t data)
+    {
+        uint32_t id = (data >> 16) & 0xffff;
+        return likely(id < events->splices_count) ? &events->splices[id * TRANSPORT_EVENTS_SPLICE_KINDS + (data & TRANSPORT_EVENT_SPLICE_POLL ? 2 : data & TRANSPORT_EVENT_SPLICE_INPUT ? 1 : 0)] : NULL;
+    }
+
+    static inline struct transport_event* transport_events_slot(struct transport_events* events, uint64_t data)
+    {
+        if (unlikely(data & TRANSPORT_EVENTS_UNBUFFERED))
+        {
+            if (data & TRANSPORT_EVENT_SPLICE)
+            {
+                return transport_events_splice(events, data);
+            }
+            uint32_t fd = data >> 32;
+            return transport_events_reserve_descriptors(events, fd) ? &events->descriptors[fd * TRANSPORT_EVENTS_DESCRIPTOR_KINDS + transport_events_descriptor_kind(data)] : NULL;
+        }
+        uint32_t buffer_id = (data >> 16) & 0xffff;
+        return likely(buffer_id < events->buffers_count) ? &events->buffers[buffer_id] : NULL;
+    }
+
+    static inline struct transport_event* transport_events_find(struct transport_events* events, uint64_t data)
+    {
+        struct transport_event* event;
+        if (unlikely(data & TRANSPORT_EVENTS_UNBUFFERED))
+        {
+            uint32_t fd = data >> 32;
+            if (data & TRANSPORT_EVENT_SPLICE)
+            {
+                event = transport_events_splice(events, data);
+            }
+            else
+            {
+                event = fd < events->descriptors_capacity ? &events->descriptors[fd * TRANSPORT_EVENTS_DESCRIPTOR_KINDS + transport_events_descriptor_kind(data)] : NULL;
+            }
+        }
+        else
+        {
+            uint32_t buffer_id = (data >> 16) & 0xffff;
+            event = buffer_id < events->buffers_count ? &events->buffers[buffer_id] : NULL;
+        }
+        return event && event->data == data ? event : NULL;
+    }
+
+    static inline void transport_events_remove(struct transport_event* event)
+    {
+        event->data = TRANSPORT_EVENTS_EMPTY;
+    }
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
@@ -0,0 +1,151 @@
+#ifndef TRANSPORT_FD_EVENTS_H
+#define TRANSPORT_FD_EVENTS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "common/common.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+#define TRANSPORT_FD_EVENTS_NONE UINT32_MAX
+
+    struct transport_fd_event
+    {
+        uint64_t data;
+        uint32_t next;
+        uint32_t previous;
+        int fd;
+    };
+
+    struct transport_fd_events
+    {
+        struct transport_fd_event* entries;
+        uint32_t capacity;
+        uint32_t free;
+        uint32_t* heads;
+        uint32_t heads_capacity;
+    };
+
+    static inline void transport_fd_events_chain(struct transport_fd_events* events, uint32_t from, uint32_t capacity)
+    {
+        for (uint32_t index = from; index < capacity; index++)
+        {
+            events->entries[index].next = index + 1 < capacity ? index + 1 : events->free;
+        }
+        events->free = from;
+    }
+
+    static inline int transport_fd_events_create(struct transport_fd_events* events, uint32_t capacity, uint32_t heads_capacity)
+    {
+        events->capacity = capacity ? capacity : 1;
+        events->heads_capacity = heads_capacity ? heads_capacity : 1;
+        events->entries = (struct transport_fd_event*)malloc(events->capacity * sizeof(struct transport_fd_event));
+        events->heads = (uint32_t*)malloc(events->heads_capacity * sizeof(uint32_t));
+        if (events->entries == NULL || events->heads == NULL)
+        {
+            return -1;
+        }
+        memset(events->heads, 0xff, events->heads_capacity * sizeof(uint32_t));
+        events->free = TRANSPORT_FD_EVENTS_NONE;
+        transport_fd_events_chain(events, 0, events->capacity);
+        return 0;
+    }
+
+    static inline void transport_fd_events_destroy(struct transport_fd_events* events)
+    {
+        free(events->entries);
+        free(events->heads);
+        events->entries = NULL;
+        events->heads = NULL;
+    }
+
+    static inline bool transport_fd_events_reserve_heads(struct transport_fd_events* events, uint32_t fd)
+    {
+        if (likely(fd < events->heads_capacity))
+        {
+            return true;
+        }
+        uint32_t capacity = events->heads_capacity;
+        while (capacity <= fd)
+        {
+            capacity *= 2;
+        }
+        uint32_t* heads = (uint32_t*)realloc(events->heads, capacity * sizeof(uint32_t));
+        if (heads == NULL)
+        {
+            return false;
+        }
+        memset(heads + events->heads_capacity, 0xff, (capacity - events->heads_capacity) * sizeof(uint32_t));
+        events->heads = heads;
+        events->heads_capacity = capacity;
+        return true;
+    }
+
+    static inline uint32_t transport_fd_events_add(struct transport_fd_events* events, int fd, uint64_t data)
+    {
+        if (unlikely(fd < 0 || !transport_fd_events_reserve_heads(events, fd)))
+        {
+            return TRANSPORT_FD_EVENTS_NONE;
+        }
+        if (unlikely(events->free == TRANSPORT_FD_EVENTS_NONE))
+        {
+            uint32_t capacity = events->capacity * 2;
+            struct transport_fd_event* entries = (struct transport_fd_event*)realloc(events->entries, capacity * sizeof(struct transport_fd_event));
+            if (entries == NULL)
+            {
+                return TRANSPORT_FD_EVENTS_NONE;
+            }
+            events->entries = entries;
+            transport_fd_events_chain(events, events->capacity, capacity);
+            events->capacity = capacity;
+        }
+        uint32_t index = events->free;
+        struct transport_fd_event* entry = &events->entries[index];
+        events->free = entry->next;
+        entry->data = data;
+        entry->fd = fd;
+        entry->previous = TRANSPORT_FD_EVENTS_NONE;
+        entry->next = events->heads[fd];
+        if (entry->next != TRANSPORT_FD_EVENTS_NONE)
+        {
+            events->entries[entry->next].previous = index;
+        }
+        events->heads[fd] = index;
+        return index;
+    }
+
+    static inline void transport_fd_events_remove(struct transport_fd_events* events, uint32_t index)
+    {
+        struct transport_fd_event* entry = &events->entries[index];
+        if (entry->previous != TRANSPORT_FD_EVENTS_NONE)
+        {
+            events->entries[entry->previous].next = entry->next;
+        }
+        else
+        {
+            events->heads[entry->fd] = entry->next;
+        }
+        if (entry->next != TRANSPORT_FD_EVENTS_NONE)
+        {
+            events->entries[entry->next].previous = entry->previous;
+        }
+        entry->next = events->free;
+        events->free = index;
+    }
+
+    static inline uint32_t transport_fd_events_head(struct transport_fd_events* events, int fd)
+    {
+        return fd >= 0 && (uint32_t)fd < events->heads_capacity ? events->heads[fd] : TRANSPORT_FD_EVENTS_NONE;
+    }
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
@@ -0,0 +1,242 @@
+#ifndef TRANSPORT_FRAMING_H
+#define TRANSPORT_FRAMING_H
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "common/common.h"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+#define TRANSPORT_FRAMING_NONE 0
+#define TRANSPORT_FRAMING_LENGTH 1
+#define TRANSPORT_FRAMING_DELIMITER 2
+
+    struct transport_framer
+    {
+        uint8_t mode;
+        uint8_t length_size;
+        uint8_t delimiter;
+        uint16_t event;
+        uint32_t max_frame_size;
+        int64_t timeout;
+        uint8_t* pending;
+        uint32_t pending_start;
+        uint32_t pending_size;
+        uint32_t pending_capacity;
+    };
+
+    struct transport_framers
+    {
+        struct transport_framer* entries;
+        uint32_t capacity;
+    };
+
+    struct transport_frame
+    {
+        uint32_t offset;
+        uint32_t size;
+        uint32_t consumed;
+    };
+
+    static inline int transport_framers_create(struct transport_framers* framers, uint32_t capacity)
+    {
+        framers->capacity = capacity ? capacity : 1;
+        framers->entries = (struct transport_framer*)calloc(framers->capacity, sizeof(struct transport_framer));
+        return framers->entries == NULL ? -1 : 0;
+    }
+
+    static inline void transport_framers_destroy(struct transport_framers* framers)
+    {
+        if (framers->entries == NULL)
+        {
+            return;
+        }
+        for (uint32_t index = 0; index < framers->capacity; index++)
+        {
+            free(framers->entries[index].pending);
+        }
+        free(framers->entries);
+        framers->entries = NULL;
+    }
+
+    static inline struct transport_framer* transport_framers_reserve(struct transport_framers* framers, uint32_t fd)
+    {
+        if (unlikely(fd >= framers->capacity))
+        {
+            uint32_t capacity = framers->capacity;
+            while (capacity <= fd)
+            {
+                capacity *= 2;
+            }
+            struct transport_framer* entries = (struct transport_framer*)realloc(framers->entries, capacity * sizeof(struct transport_framer));
+            if (entries == NULL)
+            {
+                return NULL;
+            }
+            memset(entries + framers->capacity, 0, (capacity - framers->capacity) * sizeof(struct transport_framer));
+            framers->entries = entries;
+            framers->capacity = capacity;
+        }
+        return &framers->entries[fd];
+    }
+
+    static inline struct transport_framer* transport_framers_find(struct transport_framers* framers, uint32_t fd)
+    {
+        return fd < framers->capacity && framers->entries[fd].mode != TRANSPORT_FRAMING_NONE ? &framers->entries[fd] : NULL;
+    }
+
+    static inline void transport_framer_reset(struct transport_framer* framer)
+    {
+        framer->mode = TRANSPORT_FRAMING_NONE;
+        framer->pending_start = 0;
+        framer->pending_size = 0;
+    }
+
+    static inline const uint8_t* transport_framing_find_delimiter(const uint8_t* data, size_t size, uint8_t delimiter)
+    {
+        size_t index = 0;
+#if defined(__AVX2__)
+        __m256i needle256 = _mm256_set1_epi8((char)delimiter);
+        for (; index + 32 <= size; index += 32)
+        {
+            uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(data + index)), needle256));
+            if (mask)
+            {
+                return data + index + __builtin_ctz(mask);
+            }
+        }
+#endif
+#if defined(__SSE2__)
+        __m128i needle128 = _mm_set1_epi8((char)delimiter);
+        for (; index + 16 <= size; index += 16)
+        {
+            uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(data + index)), needle128));
+            if (mask)
+            {
+                return data + index + __builtin_ctz(mask);
+            }
+        }
+#endif
+        for (; index < size; index++)
+        {
+            if (data[index] == delimiter)
+            {
+                return data + index;
+            }
+        }
+        return NULL;
+    }
+
+    static inline uint32_t transport_framing_decode_length(const uint8_t* data, uint8_t length_size)
+    {
+        uint32_t length = 0;
+        for (uint8_t index = 0; index < length_size; index++)
+        {
+            length = (length << 8) | data[index];
+        }
+        return length;
+    }
+
+    static inline int transport_framer_measure(struct transport_framer* framer, const uint8_t* data, size_t size, struct transport_frame* frame)
+    {
+        if (framer->mode == TRANSPORT_FRAMING_LENGTH)
+        {
+            if (size < framer->length_size)
+            {
+                return 0;
+            }
+            uint32_t length = transport_framing_decode_length(data, framer->length_size);
+            if (unlikely(length > framer->max_frame_size))
+            {
+                return -EMSGSIZE;
+            }
+            if (size - framer->length_size < length)
+            {
+                return 0;
+            }
+            frame->offset = framer->length_size;
+            frame->size = length;
+            frame->consumed = framer->length_size + length;
+            return 1;
+        }
+        size_t limit = size > framer->max_frame_size ? (size_t)framer->max_frame_size + 1 : size;
+        const uint8_t* delimiter = transport_framing_find_delimiter(data, limit, framer->delimiter);
+        if (delimiter == NULL)
+        {
+            return size > framer->max_frame_size ? -EMSGSIZE : 0;
+        }
+        frame->offset = 0;
+        frame->size = (uint32_t)(delimiter - data);
+        frame->consumed = frame->size + 1;
+        return 1;
+    }
+
+    static inline int transport_framer_stash(struct transport_framer* framer, const uint8_t* data, size_t size)
+    {
+        if (framer->pending_start && framer->pending_start + framer->pending_size + size > framer->pending_capacity)
+        {
+            memmove(framer->pending, framer->pending + framer->pending_start, framer->pending_size);
+            framer->pending_start = 0;
+        }
+        size_t required = (size_t)framer->pending_size + size;
+        if (required > framer->pending_capacity)
+        {
+            size_t capacity = framer->pending_capacity ? framer->pending_capacity : 64;
+            while (capacity < required)
+            {
+                capacity *= 2;
+            }
+            uint8_t* pending = (uint8_t*)realloc(framer->pending, capacity);
+            if (pending == NULL)
+            {
+                return -ENOMEM;
+            }
+            framer->pending = pending;
+            framer->pending_capacity = (uint32_t)capacity;
+        }
+        memcpy(framer->pending + framer->pending_start + framer->pending_size, data, size);
+        framer->pending_size += (uint32_t)size;
+        return 0;
+    }
+
+    static inline size_t transport_framer_missing(struct transport_framer* framer, const uint8_t* data, size_t size)
+    {
+        if (framer->mode == TRANSPORT_FRAMING_LENGTH)
+        {
+            const uint8_t* pending = framer->pending + framer->pending_start;
+            if (framer->pending_size < framer->length_size)
+            {
+                size_t header = framer->length_size - framer->pending_size;
+                if (size < header)
+                {
+                    return size;
+                }
+                uint8_t prefix[sizeof(uint32_t)];
+                memcpy(prefix, pending, framer->pending_size);
+                memcpy(prefix + framer->pending_size, data, header);
+                size_t missing = header + transport_framing_decode_length(prefix, framer->length_size);
+                return missing < size ? missing : size;
+            }
+            size_t missing = framer->length_size + transport_framing_decode_length(pending, framer->length_size) - framer->pending_size;
+            return missing < size ? missing : size;
+        }
+        const uint8_t* delimiter = transport_framing_find_delimiter(data, size, framer->delimiter);
+        return delimiter ? (size_t)(delimiter - data) + 1 : size;
+    }
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef TRANSPORT_QUEUE_H
+#define TRANSPORT_QUEUE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "common/common.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+#define TRANSPORT_QUEUE_CACHE_LINE 64
+
+    struct transport_queue
+    {
+        uint8_t* elements;
+        uint32_t element_size;
+        uint32_t mask;
+        uint8_t head_padding[TRANSPORT_QUEUE_CACHE_LINE];
+        uint32_t head;
+        uint8_t tail_padding[TRANSPORT_QUEUE_CACHE_LINE - sizeof(uint32_t)];
+        uint32_t tail;
+        uint8_t end_padding[TRANSPORT_QUEUE_CACHE_LINE - sizeof(uint32_t)];
+    };
+
+    static inline int transport_queue_create(struct transport_queue* queue, uint32_t capacity, uint32_t element_size)
+    {
+        uint32_t size = 1;
+        while (size < capacity)
+        {
+            size <<= 1;
+        }
+        queue->elements = (uint8_t*)malloc((size_t)size * element_size);
+        if (queue->elements == NULL)
+        {
+            return -1;
+        }
+        queue->element_size = element_size;
+        queue->mask = size - 1;
+        queue->head = 0;
+        queue->tail = 0;
+        return 0;
+    }
+
+    static inline void transport_queue_destroy(struct transport_queue* queue)
+    {
+        free(queue->elements);
+        queue->elements = NULL;
+    }
+
+    static inline bool transport_queue_full(struct transport_queue* queue)
+    {
+        return __atomic_load_n(&queue->tail, __ATOMIC_RELAXED) - __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE) > queue->mask;
+    }
+
+    static inline bool transport_queue_push(struct transport_queue* queue, const void* element)
+    {
+        uint32_t tail = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+        if (unlikely(tail - __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE) > queue->mask))
+        {
+            return false;
+        }
+        memcpy(queue->elements + (size_t)(tail & queue->mask) * queue->element_size, element, queue->element_size);
+        __atomic_store_n(&queue->tail, tail + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    static inline void* transport_queue_peek(struct transport_queue* queue)
+    {
+        uint32_t head = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+        if (head == __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE))
+        {
+            return NULL;
+        }
+        return queue->elements + (size_t)(head & queue->mask) * queue->element_size;
+    }
+
+    static inline void transport_queue_pop(struct transport_queue* queue)
+    {
+        __atomic_store_n(&queue->head, __atomic_load_n(&queue->head, __ATOMIC_RELAXED) + 1, __ATOMIC_RELEASE);
+    }
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
@@ -0,0 +1,154 @@
+#ifndef TRANSPORT_SPLICES_H
+#define TRANSPORT_SPLICES_H
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "common/common.h"
+#include "transport_buffers_pool.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+    struct transport_splice
+    {
+        int pipe[2];
+        uint32_t pipe_size;
+        uint32_t fd;
+        uint32_t source_fd;
+        uint64_t offset;
+        uint64_t remaining;
+        uint32_t chunk_size;
+        uint32_t requested;
+        uint32_t buffered;
+        uint64_t transferred;
+        bool broken;
+        bool proxy;
+        bool closing;
+        uint32_t peer;
+        int32_t error;
+        int64_t timeout;
+        uint16_t event;
+        uint64_t poll;
+    };
+
+    struct transport_splices
+    {
+        struct transport_splice* entries;
+        uint32_t capacity;
+        struct transport_buffers_pool free;
+    };
+
+    static inline int transport_splices_create(struct transport_splices* splices, uint32_t capacity)
+    {
+        splices->capacity = capacity;
+        splices->entries = NULL;
+        splices->free.ids = NULL;
+        splices->free.count = 0;
+        splices->free.size = 0;
+        if (capacity == 0)
+        {
+            return 0;
+        }
+        splices->entries = (struct transport_splice*)calloc(capacity, sizeof(struct transport_splice));
+        if (splices->entries == NULL || transport_buffers_pool_create(&splices->free, capacity))
+        {
+            return -1;
+        }
+        for (uint32_t index = 0; index < capacity; index++)
+        {
+            splices->entries[index].pipe[0] = -1;
+            splices->entries[index].pipe[1] = -1;
+            transport_buffers_pool_push(&splices->free, (int32_t)(capacity - index - 1));
+        }
+        return 0;
+    }
+
+    static inline void transport_splices_close_pipe(struct transport_splice* splice)
+    {
+        if (splice->pipe[0] >= 0)
+        {
+            close(splice->pipe[0]);
+            close(splice->pipe[1]);
+        }
+        splice->pipe[0] = -1;
+        splice->pipe[1] = -1;
+        splice->pipe_size = 0;
+    }
+
+    static inline void transport_splices_destroy(struct transport_splices* splices)
+    {
+        if (splices->entries == NULL)
+        {
+            return;
+        }
+        for (uint32_t index = 0; index < splices->capacity; index++)
+        {
+            transport_splices_close_pipe(&splices->entries[index]);
+        }
+        free(splices->entries);
+        splices->entries = NULL;
+        transport_buffers_pool_destroy(&splices->free);
+    }
+
+    static inline int32_t transport_splices_acquire(struct transport_splices* splices, uint32_t pipe_size)
+    {
+        int32_t id = transport_buffers_pool_pop(&splices->free);
+        if (unlikely(id == TRANSPORT_BUFFER_USED))
+        {
+            return -EBUSY;
+        }
+        struct transport_splice* splice = &splices->entries[id];
+        if (splice->pipe[0] < 0)
+        {
+            if (pipe2(splice->pipe, O_CLOEXEC))
+            {
+                int32_t error = -errno;
+                transport_buffers_pool_push(&splices->free, id);
+                return error;
+            }
+            int size = fcntl(splice->pipe[1], F_SETPIPE_SZ, (int)pipe_size);
+            if (size < 0)
+            {
+                size = fcntl(splice->pipe[1], F_GETPIPE_SZ);
+            }
+            if (size <= 0)
+            {
+                int32_t error = size < 0 ? -errno : -EINVAL;
+                transport_splices_close_pipe(splice);
+                transport_buffers_pool_push(&splices->free, id);
+                return error;
+            }
+            splice->pipe_size = (uint32_t)size;
+        }
+        splice->buffered = 0;
+        splice->transferred = 0;
+        splice->broken = false;
+        splice->proxy = false;
+        splice->closing = false;
+        splice->error = 0;
+        splice->poll = 0;
+        return id;
+    }
+
+    static inline void transport_splices_release(struct transport_splices* splices, uint32_t id)
+    {
+        struct transport_splice* splice = &splices->entries[id];
+        if (splice->buffered || splice->error)
+        {
+            transport_splices_close_pipe(splice);
+        }
+        transport_buffers_pool_push(&splices->free, (int32_t)id);
+    }
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef TRANSPORT_STREAMS_H
+#define TRANSPORT_STREAMS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "common/common.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+    struct transport_stream
+    {
+        bool armed;
+        uint16_t event;
+        int64_t timeout;
+    };
+
+    struct transport_streams
+    {
+        struct transport_stream* entries;
+        uint32_t capacity;
+    };
+
+    static inline int transport_streams_create(struct transport_streams* streams, uint32_t capacity)
+    {
+        streams->capacity = capacity ? capacity : 1;
+        streams->entries = (struct transport_stream*)calloc(streams->capacity, sizeof(struct transport_stream));
+        return streams->entries == NULL ? -1 : 0;
+    }
+
+    static inline void transport_streams_destroy(struct transport_streams* streams)
+    {
+        free(streams->entries);
+        streams->entries = NULL;
+    }
+
+    static inline struct transport_stream* transport_streams_reserve(struct transport_streams* streams, uint32_t fd)
+    {
+        if (unlikely(fd >= streams->capacity))
+        {
+            uint32_t capacity = streams->capacity;
+            while (capacity <= fd)
+            {
+                capacity *= 2;
+            }
+            struct transport_stream* entries = (struct transport_stream*)realloc(streams->entries, capacity * sizeof(struct transport_stream));
+            if (entries == NULL)
+            {
+                return NULL;
+            }
+            memset(entries + streams->capacity, 0, (capacity - streams->capacity) * sizeof(struct transport_stream));
+            streams->entries = entries;
+            streams->capacity = capacity;
+        }
+        return &streams->entries[fd];
+    }
+
+    static inline struct transport_stream* transport_streams_find(struct transport_streams* streams, uint32_t fd)
+    {
+        return fd < streams->capacity && streams->entries[fd].armed ? &streams->entries[fd] : NULL;
+    }
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
@@ -0,0 +1,132 @@
+#ifndef TRANSPORT_TAGS_H
+#define TRANSPORT_TAGS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "common/common.h"
+#include "transport_events.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+#define TRANSPORT_TAGS_NONE UINT32_MAX
+#define TRANSPORT_TAGS_INDEX(data) ((uint32_t)(data))
+#define TRANSPORT_TAGS_GENERATION(data) ((uint32_t)((data) >> 32))
+
+    struct transport_tag
+    {
+        struct transport_event event;
+        uint32_t fd;
+        uint32_t buffer_id;
+        uint32_t generation;
+        uint32_t next;
+        uint16_t code;
+    };
+
+    struct transport_tags
+    {
+        struct transport_tag* entries;
+        uint32_t capacity;
+        uint32_t free;
+        uint32_t count;
+    };
+
+    static inline void transport_tags_chain(struct transport_tags* tags, uint32_t from, uint32_t capacity)
+    {
+        for (uint32_t index = from; index < capacity; index++)
+        {
+            tags->entries[index].generation = 1;
+            tags->entries[index].event.data = TRANSPORT_EVENTS_EMPTY;
+            tags->entries[index].next = index + 1 < capacity ? index + 1 : tags->free;
+        }
+        tags->free = from;
+    }
+
+    static inline int transport_tags_create(struct transport_tags* tags, uint32_t capacity)
+    {
+        tags->capacity = capacity ? capacity : 1;
+        tags->count = 0;
+        tags->entries = (struct transport_tag*)malloc((size_t)tags->capacity * sizeof(struct transport_tag));
+        if (tags->entries == NULL)
+        {
+            return -1;
+        }
+        tags->free = TRANSPORT_TAGS_NONE;
+        transport_tags_chain(tags, 0, tags->capacity);
+        return 0;
+    }
+
+    static inline void transport_tags_destroy(struct transport_tags* tags)
+    {
+        free(tags->entries);
+        tags->entries = NULL;
+    }
+
+    static inline bool transport_tags_grow(struct transport_tags* tags)
+    {
+        if (tags->capacity >= TRANSPORT_TAGS_NONE / 2)
+        {
+            return false;
+        }
+        uint32_t capacity = tags->capacity * 2;
+        struct transport_tag* entries = (struct transport_tag*)realloc(tags->entries, (size_t)capacity * sizeof(struct transport_tag));
+        if (entries == NULL)
+        {
+            return false;
+        }
+        tags->entries = entries;
+        transport_tags_chain(tags, tags->capacity, capacity);
+        tags->capacity = capacity;
+        return true;
+    }
+
+    static inline uint64_t transport_tags_acquire(struct transport_tags* tags, uint32_t fd, uint32_t buffer_id, uint16_t code)
+    {
+        if (unlikely(tags->free == TRANSPORT_TAGS_NONE) && !transport_tags_grow(tags))
+        {
+            return TRANSPORT_EVENTS_EMPTY;
+        }
+        uint32_t index = tags->free;
+        struct transport_tag* tag = &tags->entries[index];
+        tags->free = tag->next;
+        tags->count++;
+        tag->fd = fd;
+        tag->buffer_id = buffer_id;
+        tag->code = code;
+        tag->event.data = TRANSPORT_EVENTS_EMPTY;
+        return ((uint64_t)tag->generation << 32) | index;
+    }
+
+    static inline struct transport_tag* transport_tags_resolve(struct transport_tags* tags, uint64_t data)
+    {
+        uint32_t index = TRANSPORT_TAGS_INDEX(data);
+        if (unlikely(index >= tags->capacity))
+        {
+            return NULL;
+        }
+        struct transport_tag* tag = &tags->entries[index];
+        return likely(tag->generation == TRANSPORT_TAGS_GENERATION(data)) ? tag : NULL;
+    }
+
+    static inline void transport_tags_release(struct transport_tags* tags, struct transport_tag* tag)
+    {
+        if (unlikely(++tag->generation == 0))
+        {
+            tag->generation = 1;
+        }
+        tag->event.data = TRANSPORT_EVENTS_EMPTY;
+        tag->next = tags->free;
+        tags->free = (uint32_t)(tag - tags->entries);
+        tags->count--;
+    }
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
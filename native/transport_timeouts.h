@@ -0,0 +1,231 @@
+#ifndef TRANSPORT_TIMEOUTS_H
+#define TRANSPORT_TIMEOUTS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "common/common.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+#define TRANSPORT_TIMEOUTS_NONE UINT32_MAX
+#define TRANSPORT_TIMEOUTS_LEVELS 4
+#define TRANSPORT_TIMEOUTS_SLOT_BITS 6
+#define TRANSPORT_TIMEOUTS_SLOTS (1 << TRANSPORT_TIMEOUTS_SLOT_BITS)
+#define TRANSPORT_TIMEOUTS_SLOT_MASK (TRANSPORT_TIMEOUTS_SLOTS - 1)
+#define TRANSPORT_TIMEOUTS_MAX_DELTA (((uint64_t)1 << (TRANSPORT_TIMEOUTS_SLOT_BITS * TRANSPORT_TIMEOUTS_LEVELS)) - 1)
+
+    struct transport_timeout
+    {
+        uint64_t data;
+        uint64_t deadline;
+        uint64_t timeout;
+        uint32_t next;
+        uint32_t previous;
+        uint32_t slot;
+    };
+
+    struct transport_timeouts
+    {
+        struct transport_timeout* entries;
+        uint32_t capacity;
+        uint32_t free;
+        uint32_t count;
+        uint32_t expired;
+        uint64_t current;
+        uint32_t slots[TRANSPORT_TIMEOUTS_LEVELS * TRANSPORT_TIMEOUTS_SLOTS];
+    };
+
+    static inline uint64_t transport_timeouts_now()
+    {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC_COARSE, &now);
+        return (uint64_t)now.tv_sec * 1000 + now.tv_nsec / 1000000;
+    }
+
+    static inline void transport_timeouts_chain(struct transport_timeouts* timeouts, uint32_t from, uint32_t capacity)
+    {
+        for (uint32_t index = from; index < capacity; index++)
+        {
+            timeouts->entries[index].next = index + 1 < capacity ? index + 1 : timeouts->free;
+        }
+        timeouts->free = from;
+    }
+
+    static inline int transport_timeouts_create(struct transport_timeouts* timeouts, uint32_t capacity)
+    {
+        timeouts->capacity = capacity ? capacity : 1;
+        timeouts->entries = (struct transport_timeout*)malloc(timeouts->capacity * sizeof(struct transport_timeout));
+        if (timeouts->entries == NULL)
+        {
+            return -1;
+        }
+        timeouts->free = TRANSPORT_TIMEOUTS_NONE;
+        timeouts->count = 0;
+        timeouts->expired = TRANSPORT_TIMEOUTS_NONE;
+        timeouts->current = transport_timeouts_now();
+        memset(timeouts->slots, 0xff, sizeof(timeouts->slots));
+        transport_timeouts_chain(timeouts, 0, timeouts->capacity);
+        return 0;
+    }
+
+    static inline void transport_timeouts_destroy(struct transport_timeouts* timeouts)
+    {
+        free(timeouts->entries);
+        timeouts->entries = NULL;
+    }
+
+    static inline void transport_timeouts_link(struct transport_timeouts* timeouts, uint32_t* head, uint32_t index, uint32_t slot)
+    {
+        struct transport_timeout* entry = &timeouts->entries[index];
+        entry->slot = slot;
+        entry->previous = TRANSPORT_TIMEOUTS_NONE;
+        entry->next = *head;
+        if (*head != TRANSPORT_TIMEOUTS_NONE)
+        {
+            timeouts->entries[*head].previous = index;
+        }
+        *head = index;
+    }
+
+    static inline void transport_timeouts_place(struct transport_timeouts* timeouts, uint32_t index, uint64_t base)
+    {
+        uint64_t deadline = timeouts->entries[index].deadline;
+        uint64_t delta = deadline > base ? deadline - base : 0;
+        if (delta > TRANSPORT_TIMEOUTS_MAX_DELTA)
+        {
+            delta = TRANSPORT_TIMEOUTS_MAX_DELTA;
+        }
+        uint64_t expires = base + delta;
+        uint32_t level = 0;
+        while (level < TRANSPORT_TIMEOUTS_LEVELS - 1 && delta >= ((uint64_t)1 << (TRANSPORT_TIMEOUTS_SLOT_BITS * (level + 1))))
+        {
+            level++;
+        }
+        uint32_t slot = level * TRANSPORT_TIMEOUTS_SLOTS + ((expires >> (TRANSPORT_TIMEOUTS_SLOT_BITS * level)) & TRANSPORT_TIMEOUTS_SLOT_MASK);
+        transport_timeouts_link(timeouts, &timeouts->slots[slot], index, slot);
+    }
+
+    static inline void transport_timeouts_unlink(struct transport_timeouts* timeouts, uint32_t index)
+    {
+        struct transport_timeout* entry = &timeouts->entries[index];
+        uint32_t* head = entry->slot == TRANSPORT_TIMEOUTS_NONE ? &timeouts->expired : &timeouts->slots[entry->slot];
+        if (entry->previous != TRANSPORT_TIMEOUTS_NONE)
+        {
+            timeouts->entries[entry->previous].next = entry->next;
+        }
+        else
+        {
+            *head = entry->next;
+        }
+        if (entry->next != TRANSPORT_TIMEOUTS_NONE)
+        {
+            timeouts->entries[entry->next].previous = entry->previous;
+        }
+    }
+
+    static inline uint32_t transport_timeouts_add(struct transport_timeouts* timeouts, uint64_t data, uint64_t now, uint64_t timeout)
+    {
+        if (unlikely(timeouts->free == TRANSPORT_TIMEOUTS_NONE))
+        {
+            uint32_t capacity = timeouts->capacity * 2;
+            struct transport_timeout* entries = (struct transport_timeout*)realloc(timeouts->entries, capacity * sizeof(struct transport_timeout));
+            if (entries == NULL)
+            {
+                return TRANSPORT_TIMEOUTS_NONE;
+            }
+            timeouts->entries = entries;
+            transport_timeouts_chain(timeouts, timeouts->capacity, capacity);
+            timeouts->capacity = capacity;
+        }
+        uint32_t index = timeouts->free;
+        timeouts->free = timeouts->entries[index].next;
+        timeouts->entries[index].data = data;
+        timeouts->entries[index].deadline = now + timeout;
+        timeouts->entries[index].timeout = timeout;
+        transport_timeouts_place(timeouts, index, timeouts->current + 1);
+        timeouts->count++;
+        return index;
+    }
+
+    static inline void transport_timeouts_remove(struct transport_timeouts* timeouts, uint32_t index)
+    {
+        transport_timeouts_unlink(timeouts, index);
+        timeouts->entries[index].next = timeouts->free;
+        timeouts->free = index;
+        timeouts->count--;
+    }
+
+    static inline void transport_timeouts_restart(struct transport_timeouts* timeouts, uint32_t index, uint64_t now)
+    {
+        transport_timeouts_unlink(timeouts, index);
+        timeouts->entries[index].deadline = now + timeouts->entries[index].timeout;
+        transport_timeouts_place(timeouts, index, timeouts->current + 1);
+    }
+
+    static inline void transport_timeouts_cascade(struct transport_timeouts* timeouts, uint32_t slot, uint64_t base)
+    {
+        uint32_t index = timeouts->slots[slot];
+        timeouts->slots[slot] = TRANSPORT_TIMEOUTS_NONE;
+        while (index != TRANSPORT_TIMEOUTS_NONE)
+        {
+            uint32_t next = timeouts->entries[index].next;
+            transport_timeouts_place(timeouts, index, base);
+            index = next;
+        }
+    }
+
+    static inline void transport_timeouts_advance(struct transport_timeouts* timeouts, uint64_t now)
+    {
+        if (timeouts->count == 0)
+        {
+            timeouts->current = now > timeouts->current ? now : timeouts->current;
+            return;
+        }
+        while (timeouts->current < now)
+        {
+            uint64_t tick = ++timeouts->current;
+            for (uint32_t level = 1; level < TRANSPORT_TIMEOUTS_LEVELS; level++)
+            {
+                if (tick & (((uint64_t)1 << (TRANSPORT_TIMEOUTS_SLOT_BITS * level)) - 1))
+                {
+                    break;
+                }
+                uint32_t slot = level * TRANSPORT_TIMEOUTS_SLOTS + ((tick >> (TRANSPORT_TIMEOUTS_SLOT_BITS * level)) & TRANSPORT_TIMEOUTS_SLOT_MASK);
+                transport_timeouts_cascade(timeouts, slot, tick);
+            }
+            uint32_t slot = tick & TRANSPORT_TIMEOUTS_SLOT_MASK;
+            uint32_t index = timeouts->slots[slot];
+            timeouts->slots[slot] = TRANSPORT_TIMEOUTS_NONE;
+            while (index != TRANSPORT_TIMEOUTS_NONE)
+            {
+                uint32_t next = timeouts->entries[index].next;
+                transport_timeouts_link(timeouts, &timeouts->expired, index, TRANSPORT_TIMEOUTS_NONE);
+                index = next;
+            }
+        }
+    }
+
+    static inline bool transport_timeouts_pop_expired(struct transport_timeouts* timeouts, uint64_t* data)
+    {
+        uint32_t index = timeouts->expired;
+        if (index == TRANSPORT_TIMEOUTS_NONE)
+        {
+            return false;
+        }
+        *data = timeouts->entries[index].data;
+        transport_timeouts_remove(timeouts, index);
+        return true;
+    }
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
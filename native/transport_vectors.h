@@ -0,0 +1,109 @@
+#ifndef TRANSPORT_VECTORS_H
+#define TRANSPORT_VECTORS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/uio.h>
+#include "common/common.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+    struct transport_vector
+    {
+        struct iovec* iovecs;
+        uint32_t capacity;
+        uint32_t count;
+        uint32_t index;
+        uint64_t offset;
+        size_t total;
+        size_t done;
+        int64_t timeout;
+    };
+
+    struct transport_vectors
+    {
+        struct transport_vector* entries;
+        uint32_t capacity;
+    };
+
+    static inline int transport_vectors_create(struct transport_vectors* vectors, uint32_t capacity)
+    {
+        vectors->capacity = capacity ? capacity : 1;
+        vectors->entries = (struct transport_vector*)calloc(vectors->capacity, sizeof(struct transport_vector));
+        return vectors->entries == NULL ? -1 : 0;
+    }
+
+    static inline void transport_vectors_destroy(struct transport_vectors* vectors)
+    {
+        if (vectors->entries == NULL)
+        {
+            return;
+        }
+        for (uint32_t index = 0; index < vectors->capacity; index++)
+        {
+            free(vectors->entries[index].iovecs);
+        }
+        free(vectors->entries);
+        vectors->entries = NULL;
+    }
+
+    static inline struct transport_vector* transport_vectors_prepare(struct transport_vectors* vectors,
+                                                                     struct iovec* buffers,
+                                                                     uint32_t* buffer_ids,
+                                                                     uint32_t count,
+                                                                     uint64_t offset,
+                                                                     int64_t timeout)
+    {
+        struct transport_vector* vector = &vectors->entries[buffer_ids[0]];
+        if (unlikely(vector->capacity < count))
+        {
+            struct iovec* iovecs = (struct iovec*)realloc(vector->iovecs, (size_t)count * sizeof(struct iovec));
+            if (iovecs == NULL)
+            {
+                return NULL;
+            }
+            vector->iovecs = iovecs;
+            vector->capacity = count;
+        }
+        vector->total = 0;
+        for (uint32_t index = 0; index < count; index++)
+        {
+            vector->iovecs[index] = buffers[buffer_ids[index]];
+            vector->total += buffers[buffer_ids[index]].iov_len;
+        }
+        vector->count = count;
+        vector->index = 0;
+        vector->offset = offset;
+        vector->done = 0;
+        vector->timeout = timeout;
+        return vector;
+    }
+
+    static inline void transport_vectors_advance(struct transport_vector* vector, size_t bytes)
+    {
+        vector->done += bytes;
+        while (bytes && vector->index < vector->count)
+        {
+            struct iovec* iovec = &vector->iovecs[vector->index];
+            if (bytes < iovec->iov_len)
+            {
+                iovec->iov_base = (uint8_t*)iovec->iov_base + bytes;
+                iovec->iov_len -= bytes;
+                return;
+            }
+            bytes -= iovec->iov_len;
+            vector->index++;
+        }
+    }
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
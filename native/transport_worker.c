@@ -1,8 +1,179 @@
 #include "transport_worker.h"
+#include <poll.h>
+#include <sched.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
 #include <unistd.h>
 #include "transport_common.h"
 #include "transport_constants.h"
 
+enum transport_worker_operation_code
+{
+    TRANSPORT_OPERATION_WRITE,
+    TRANSPORT_OPERATION_WRITE_VECTOR,
+    TRANSPORT_OPERATION_READ,
+    TRANSPORT_OPERATION_SEND_ZERO_COPY,
+    TRANSPORT_OPERATION_SEND_MESSAGE,
+    TRANSPORT_OPERATION_SEND_MESSAGE_ZERO_COPY,
+    TRANSPORT_OPERATION_RECEIVE_MESSAGE,
+    TRANSPORT_OPERATION_READ_MULTISHOT,
+    TRANSPORT_OPERATION_SPLICE,
+    TRANSPORT_OPERATION_CONNECT,
+    TRANSPORT_OPERATION_ACCEPT,
+    TRANSPORT_OPERATION_ACCEPT_MULTISHOT,
+    TRANSPORT_OPERATION_CANCEL_BY_FD,
+    TRANSPORT_OPERATION_CANCEL_EVENT,
+    TRANSPORT_OPERATION_CANCEL_PROXY,
+    TRANSPORT_OPERATION_ARM_WAKEUP,
+};
+
+#define TRANSPORT_OPERATION_MAX_SQES 4
+#define TRANSPORT_HUGE_PAGE_SIZE ((size_t)2 * 1024 * 1024)
+
+struct transport_worker_operation
+{
+    uint8_t code;
+    uint8_t sqe_flags;
+    uint32_t buffer_id;
+    uint16_t event;
+    transport_socket_family_t socket_family;
+    uint32_t fd;
+    uint32_t offset;
+    int message_flags;
+    int64_t timeout;
+    uint64_t data;
+    void* pointer;
+};
+
+struct transport_worker_completion
+{
+    uint32_t fd;
+    uint32_t buffer_id;
+    uint16_t event;
+    int32_t result;
+    uint32_t flags;
+};
+
+static inline int transport_worker_start_io_thread(transport_worker_t* worker);
+static inline void transport_worker_fail_operation(transport_worker_t* worker, uint32_t fd, uint32_t buffer_id, uint16_t event, int32_t result);
+
+static inline void* transport_worker_map_buffers(size_t* size, bool huge_pages)
+{
+    void* arena;
+    if (huge_pages)
+    {
+        size_t huge_size = (*size + TRANSPORT_HUGE_PAGE_SIZE - 1) & ~(TRANSPORT_HUGE_PAGE_SIZE - 1);
+        arena = mmap(NULL, huge_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (arena != MAP_FAILED)
+        {
+            *size = huge_size;
+            return arena;
+        }
+    }
+    size_t page_size = getpagesize();
+    *size = (*size + page_size - 1) & ~(page_size - 1);
+    arena = mmap(NULL, *size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (arena == MAP_FAILED)
+    {
+        return NULL;
+    }
+    if (huge_pages)
+    {
+        madvise(arena, *size, MADV_HUGEPAGE);
+    }
+    return arena;
+}
+
+static inline int transport_worker_create_buffer_classes(transport_worker_t* worker, transport_worker_configuration_t* configuration)
+{
+    if (configuration->buffer_classes_count > TRANSPORT_BUFFER_CLASSES_MAX)
+    {
+        return -EINVAL;
+    }
+    worker->buffer_classes_count = configuration->buffer_classes_count + 1;
+    worker->buffer_classes = calloc(worker->buffer_classes_count, sizeof(struct transport_buffers_class));
+    if (!worker->buffer_classes)
+    {
+        return -ENOMEM;
+    }
+    uint64_t limit = configuration->wide_tags ? INT32_MAX : UINT16_MAX;
+    uint64_t total = 0;
+    for (uint8_t index = 0; index < worker->buffer_classes_count; index++)
+    {
+        struct transport_buffers_class* buffer_class = &worker->buffer_classes[index];
+        buffer_class->size = index ? configuration->buffer_class_sizes[index - 1] : configuration->buffer_size;
+        buffer_class->count = index ? configuration->buffer_class_counts[index - 1] : configuration->buffers_count;
+        buffer_class->first = total;
+        total += buffer_class->count;
+        if (!buffer_class->size || !buffer_class->count || total > limit)
+        {
+            return -EINVAL;
+        }
+    }
+    if (configuration->max_buffers_count > limit)
+    {
+        return -EINVAL;
+    }
+    worker->buffers_count = total;
+    worker->static_buffers_count = total;
+    worker->buffers_capacity = configuration->max_buffers_count > total ? configuration->max_buffers_count : total;
+    worker->registered_buffers_count = worker->buffers_capacity < TRANSPORT_REGISTERED_BUFFERS_MAX ? worker->buffers_capacity : TRANSPORT_REGISTERED_BUFFERS_MAX;
+    for (uint8_t index = 0; index < worker->buffer_classes_count; index++)
+    {
+        struct transport_buffers_class* buffer_class = &worker->buffer_classes[index];
+        size_t size = buffer_class->count + (index ? 0 : worker->buffers_capacity - total);
+        if (transport_buffers_pool_create(&buffer_class->free_buffers, size))
+        {
+            return -ENOMEM;
+        }
+    }
+    if (worker->buffers_capacity > total)
+    {
+        worker->buffers_grow_chunk = configuration->buffers_grow_chunk ? configuration->buffers_grow_chunk : worker->buffer_classes[0].count;
+        worker->buffers_chunks = calloc((worker->buffers_capacity - total + worker->buffers_grow_chunk - 1) / worker->buffers_grow_chunk, sizeof(struct transport_buffers_chunk));
+        if (!worker->buffers_chunks)
+        {
+            return -ENOMEM;
+        }
+    }
+    return 0;
+}
+
+static inline int transport_worker_create_buffers(transport_worker_t* worker, bool huge_pages)
+{
+    size_t page_size = getpagesize();
+    size_t offsets[TRANSPORT_BUFFER_CLASSES_MAX + 1];
+    worker->buffers_arena_size = 0;
+    for (uint8_t index = 0; index < worker->buffer_classes_count; index++)
+    {
+        offsets[index] = worker->buffers_arena_size;
+        size_t region = (size_t)worker->buffer_classes[index].count * worker->buffer_classes[index].size;
+        worker->buffers_arena_size += (region + page_size - 1) & ~(page_size - 1);
+    }
+    worker->buffers_arena = transport_worker_map_buffers(&worker->buffers_arena_size, huge_pages);
+    if (!worker->buffers_arena)
+    {
+        return -ENOMEM;
+    }
+    for (uint8_t index = 0; index < worker->buffer_classes_count; index++)
+    {
+        struct transport_buffers_class* buffer_class = &worker->buffer_classes[index];
+        uint8_t* region = (uint8_t*)worker->buffers_arena + offsets[index];
+        for (uint32_t buffer = 0; buffer < buffer_class->count; buffer++)
+        {
+            uint32_t buffer_id = buffer_class->first + buffer;
+            worker->buffers[buffer_id].iov_base = region + (size_t)buffer * buffer_class->size;
+            worker->buffers[buffer_id].iov_len = buffer_class->size;
+            if (buffer_id >= worker->provided_buffers_count)
+            {
+                transport_buffers_pool_push(&buffer_class->free_buffers, buffer_id);
+            }
+        }
+    }
+    return 0;
+}
+
 int transport_worker_initialize(transport_worker_t* worker,
                                 transport_worker_configuration_t* configuration,
                                 uint8_t id)
@@ -13,160 +184,2056 @@ int transport_worker_initialize(transport_worker_t* worker,
     worker->base_delay_micros = configuration->base_delay_micros;
     worker->max_delay_micros = configuration->max_delay_micros;
     worker->buffer_size = configuration->buffer_size;
-    worker->buffers_count = configuration->buffers_count;
+    worker->zero_buffers = configuration->zero_buffers;
+    worker->huge_pages = configuration->huge_pages;
+    worker->buffers_shrink_idle_millis = configuration->buffers_shrink_idle_millis;
+    worker->provided_buffers_count = configuration->provided_buffers_count;
+    worker->registered_files_count = configuration->registered_files_count;
+    worker->link_timeouts = configuration->link_timeouts;
+    worker->eventfd_wakeups = configuration->eventfd_wakeups;
+    worker->wakeup_fd = -1;
+    worker->io_thread = configuration->io_thread;
+    worker->io_thread_cpu = configuration->io_thread_cpu;
+    worker->io_thread_wakeup_fd = -1;
     worker->timeout_checker_period_millis = configuration->timeout_checker_period_millis;
     worker->cqes = malloc(sizeof(struct io_uring_cqe) * worker->ring_size);
-    worker->buffers = malloc(sizeof(struct iovec) * configuration->buffers_count);
     worker->cqe_wait_timeout_millis = configuration->cqe_wait_timeout_millis;
     worker->cqe_wait_count = configuration->cqe_wait_count;
     worker->cqe_peek_count = configuration->cqe_peek_count;
+    worker->wide_tags = configuration->wide_tags;
     worker->trace = configuration->trace;
+
+    int result = transport_worker_create_buffer_classes(worker, configuration);
+    if (result)
+    {
+        return result;
+    }
+
+    if (worker->io_thread && (worker->registered_files_count || worker->buffers_capacity > worker->static_buffers_count))
+    {
+        return -EINVAL;
+    }
+
+    worker->buffers = calloc(worker->buffers_capacity, sizeof(struct iovec));
     if (!worker->buffers)
     {
         return -ENOMEM;
     }
 
-    worker->events = mh_events_new();
-    if (!worker->events)
+    worker->completion_fds = malloc(sizeof(uint32_t) * worker->cqe_peek_count);
+    worker->completion_buffer_ids = malloc(sizeof(uint32_t) * worker->cqe_peek_count);
+    worker->completion_events = malloc(sizeof(uint16_t) * worker->cqe_peek_count);
+    worker->completion_results = malloc(sizeof(int32_t) * worker->cqe_peek_count);
+    worker->completion_flags = malloc(sizeof(uint32_t) * worker->cqe_peek_count);
+    if (!worker->completion_fds || !worker->completion_buffer_ids || !worker->completion_events || !worker->completion_results || !worker->completion_flags)
+    {
+        return -ENOMEM;
+    }
+
+    if (worker->provided_buffers_count &&
+        (worker->provided_buffers_count >= worker->buffer_classes[0].count || (worker->provided_buffers_count & (worker->provided_buffers_count - 1))))
+    {
+        return -EINVAL;
+    }
+
+    if (worker->wide_tags ? transport_tags_create(&worker->tags, worker->buffers_capacity)
+                          : transport_events_create(&worker->events, worker->buffers_capacity, worker->registered_files_count, configuration->splice_pipes_count))
+    {
+        return -ENOMEM;
+    }
+
+    if (transport_vectors_create(&worker->vectors, worker->buffers_capacity))
+    {
+        return -ENOMEM;
+    }
+    worker->vector_buffer_ids = malloc(sizeof(uint32_t) * worker->buffers_capacity);
+    if (!worker->vector_buffer_ids || transport_buffers_references_create(&worker->buffer_references, worker->buffers_capacity))
+    {
+        return -ENOMEM;
+    }
+
+    if (transport_framers_create(&worker->framers, worker->registered_files_count) ||
+        transport_streams_create(&worker->streams, worker->registered_files_count) ||
+        transport_backlog_create(&worker->frames, worker->cqe_peek_count, sizeof(struct transport_worker_completion)))
+    {
+        return -ENOMEM;
+    }
+
+    if (!worker->wide_tags && configuration->splice_pipes_count > UINT16_MAX)
+    {
+        return -EINVAL;
+    }
+    if (transport_splices_create(&worker->splices, configuration->splice_pipes_count))
+    {
+        return -ENOMEM;
+    }
+
+    if (transport_timeouts_create(&worker->timeouts, worker->buffers_capacity))
+    {
+        return -ENOMEM;
+    }
+
+    if (transport_fd_events_create(&worker->fd_events, worker->buffers_capacity, worker->registered_files_count))
     {
         return -ENOMEM;
     }
-    mh_events_reserve(worker->events, worker->buffers_count, 0);
 
-    int result = transport_buffers_pool_create(&worker->free_buffers, configuration->buffers_count);
-    if (result == -1)
+    worker->inet_used_messages = calloc(worker->buffers_capacity, sizeof(struct msghdr));
+    worker->unix_used_messages = calloc(worker->buffers_capacity, sizeof(struct msghdr));
+    worker->inet_used_addresses = calloc(worker->buffers_capacity, sizeof(struct sockaddr_in));
+    worker->unix_used_addresses = calloc(worker->buffers_capacity, sizeof(struct sockaddr_un));
+    if (!worker->inet_used_messages || !worker->unix_used_messages || !worker->inet_used_addresses || !worker->unix_used_addresses)
     {
         return -ENOMEM;
     }
 
-    worker->inet_used_messages = malloc(sizeof(struct msghdr) * configuration->buffers_count);
-    worker->unix_used_messages = malloc(sizeof(struct msghdr) * configuration->buffers_count);
+    for (size_t index = 0; index < worker->buffers_capacity; index++)
+    {
+        worker->inet_used_messages[index].msg_name = &worker->inet_used_addresses[index];
+        worker->inet_used_messages[index].msg_namelen = sizeof(struct sockaddr_in);
+
+        worker->unix_used_messages[index].msg_name = &worker->unix_used_addresses[index];
+        worker->unix_used_messages[index].msg_namelen = sizeof(struct sockaddr_un);
+    }
+
+    result = transport_worker_create_buffers(worker, configuration->huge_pages);
+    if (result)
+    {
+        return result;
+    }
+
+    worker->ring = malloc(sizeof(struct io_uring));
+    if (!worker->ring)
+    {
+        return -ENOMEM;
+    }
+    result = io_uring_queue_init(configuration->ring_size, worker->ring, configuration->ring_flags);
+    if (result)
+    {
+        return result;
+    }
 
-    if (!worker->inet_used_messages || !worker->unix_used_messages)
+    worker->submit_threshold = worker->ring->sq.ring_entries * configuration->submit_fill_factor;
+    if (worker->submit_threshold == 0 || worker->submit_threshold > worker->ring->sq.ring_entries)
+    {
+        worker->submit_threshold = worker->ring->sq.ring_entries;
+    }
+    if (transport_backlog_create(&worker->backlog, worker->ring_size, sizeof(struct transport_worker_operation)))
     {
         return -ENOMEM;
     }
 
-    for (size_t index = 0; index < configuration->buffers_count; index++)
+    uint32_t registered = worker->buffers_count < worker->registered_buffers_count ? worker->buffers_count : worker->registered_buffers_count;
+    if (worker->registered_buffers_count > registered)
+    {
+        result = io_uring_register_buffers_sparse(worker->ring, worker->registered_buffers_count);
+        if (result)
+        {
+            return result;
+        }
+        result = io_uring_register_buffers_update_tag(worker->ring, 0, worker->buffers, NULL, registered);
+        if (result < 0)
+        {
+            return result;
+        }
+    }
+    else
+    {
+        result = io_uring_register_buffers(worker->ring, worker->buffers, registered);
+        if (result)
+        {
+            return result;
+        }
+    }
+    worker->buffers_pressure_time = transport_timeouts_now();
+
+    if (worker->provided_buffers_count)
     {
-        if (posix_memalign(&worker->buffers[index].iov_base, getpagesize(), configuration->buffer_size))
+        if (posix_memalign((void**)&worker->provided_buffers, getpagesize(), sizeof(struct io_uring_buf) * worker->provided_buffers_count))
         {
             return -ENOMEM;
         }
-        memset(worker->buffers[index].iov_base, 0, configuration->buffer_size);
-        worker->buffers[index].iov_len = configuration->buffer_size;
+        struct io_uring_buf_reg registration = {
+            .ring_addr = (uint64_t)worker->provided_buffers,
+            .ring_entries = worker->provided_buffers_count,
+            .bgid = TRANSPORT_PROVIDED_BUFFERS_GROUP,
+        };
+        result = io_uring_register_buf_ring(worker->ring, &registration, 0);
+        if (result)
+        {
+            return result;
+        }
+        io_uring_buf_ring_init(worker->provided_buffers);
+        int mask = io_uring_buf_ring_mask(worker->provided_buffers_count);
+        for (uint16_t index = 0; index < worker->provided_buffers_count; index++)
+        {
+            io_uring_buf_ring_add(worker->provided_buffers, worker->buffers[index].iov_base, worker->buffer_size, index, mask, index);
+        }
+        io_uring_buf_ring_advance(worker->provided_buffers, worker->provided_buffers_count);
+    }
 
-        memset(&worker->inet_used_messages[index], 0, sizeof(struct msghdr));
-        worker->inet_used_messages[index].msg_name = malloc(sizeof(struct sockaddr_in));
-        if (!worker->inet_used_messages[index].msg_name)
+    if (worker->registered_files_count)
+    {
+        worker->registered_files = calloc(worker->registered_files_count, sizeof(bool));
+        if (!worker->registered_files)
         {
             return -ENOMEM;
         }
-        worker->inet_used_messages[index].msg_namelen = sizeof(struct sockaddr_in);
+        result = io_uring_register_files_sparse(worker->ring, worker->registered_files_count);
+        if (result)
+        {
+            return result;
+        }
+    }
 
-        memset(&worker->unix_used_messages[index], 0, sizeof(struct msghdr));
-        worker->unix_used_messages[index].msg_name = malloc(sizeof(struct sockaddr_un));
-        if (!worker->unix_used_messages[index].msg_name)
+    if (worker->link_timeouts)
+    {
+        worker->link_timeout_specs = calloc(worker->ring->sq.ring_entries, sizeof(struct __kernel_timespec));
+        if (!worker->link_timeout_specs)
         {
             return -ENOMEM;
         }
-        worker->unix_used_messages[index].msg_namelen = sizeof(struct sockaddr_un);
+    }
 
-        transport_buffers_pool_push(&worker->free_buffers, index);
+    if (worker->io_thread)
+    {
+        return transport_worker_start_io_thread(worker);
     }
-    worker->ring = malloc(sizeof(struct io_uring));
-    if (!worker->ring)
+
+    return 0;
+}
+
+static inline int transport_worker_update_registered_buffers(transport_worker_t* worker, uint32_t first, uint32_t count)
+{
+    if (first >= worker->registered_buffers_count)
+    {
+        return 0;
+    }
+    if (count > worker->registered_buffers_count - first)
+    {
+        count = worker->registered_buffers_count - first;
+    }
+    return io_uring_register_buffers_update_tag(worker->ring, first, &worker->buffers[first], NULL, count);
+}
+
+int32_t transport_worker_grow_buffers(transport_worker_t* worker)
+{
+    worker->buffers_pressure_time = transport_timeouts_now();
+    uint32_t count = worker->buffers_capacity - worker->buffers_count;
+    if (count > worker->buffers_grow_chunk)
+    {
+        count = worker->buffers_grow_chunk;
+    }
+    if (!count)
+    {
+        return 0;
+    }
+    struct transport_buffers_class* buffer_class = &worker->buffer_classes[0];
+    struct transport_buffers_chunk* chunk = &worker->buffers_chunks[worker->buffers_chunks_count];
+    chunk->first = worker->buffers_count;
+    chunk->count = count;
+    chunk->size = (size_t)count * buffer_class->size;
+    chunk->memory = transport_worker_map_buffers(&chunk->size, worker->huge_pages);
+    if (!chunk->memory)
     {
         return -ENOMEM;
     }
-    result = io_uring_queue_init(configuration->ring_size, worker->ring, configuration->ring_flags);
-    if (result)
+    for (uint32_t index = 0; index < count; index++)
+    {
+        worker->buffers[chunk->first + index].iov_base = (uint8_t*)chunk->memory + (size_t)index * buffer_class->size;
+        worker->buffers[chunk->first + index].iov_len = buffer_class->size;
+    }
+    int result = transport_worker_update_registered_buffers(worker, chunk->first, count);
+    if (result < 0)
     {
+        memset(&worker->buffers[chunk->first], 0, sizeof(struct iovec) * count);
+        munmap(chunk->memory, chunk->size);
         return result;
     }
+    for (uint32_t index = 0; index < count; index++)
+    {
+        transport_buffers_pool_push(&buffer_class->free_buffers, chunk->first + index);
+    }
+    worker->buffers_count += count;
+    worker->buffers_chunks_count++;
+    worker->buffers_grows++;
+    return count;
+}
 
-    result = io_uring_register_buffers(worker->ring, worker->buffers, worker->buffers_count);
-    if (result)
+int32_t transport_worker_shrink_buffers(transport_worker_t* worker)
+{
+    if (!worker->buffers_chunks_count)
+    {
+        return 0;
+    }
+    struct transport_buffers_pool* pool = &worker->buffer_classes[0].free_buffers;
+    struct transport_buffers_chunk* chunk = &worker->buffers_chunks[worker->buffers_chunks_count - 1];
+    if (pool->count < chunk->count)
+    {
+        return 0;
+    }
+    uint64_t now = transport_timeouts_now();
+    if (now - worker->buffers_pressure_time < worker->buffers_shrink_idle_millis)
+    {
+        return 0;
+    }
+    worker->buffers_pressure_time = now;
+    if (transport_buffers_pool_count_from(pool, chunk->first) != chunk->count)
+    {
+        return 0;
+    }
+    memset(&worker->buffers[chunk->first], 0, sizeof(struct iovec) * chunk->count);
+    int result = transport_worker_update_registered_buffers(worker, chunk->first, chunk->count);
+    if (result < 0)
     {
+        for (uint32_t index = 0; index < chunk->count; index++)
+        {
+            worker->buffers[chunk->first + index].iov_base = (uint8_t*)chunk->memory + (size_t)index * worker->buffer_classes[0].size;
+            worker->buffers[chunk->first + index].iov_len = worker->buffer_classes[0].size;
+        }
         return result;
     }
+    transport_buffers_pool_remove_from(pool, chunk->first);
+    munmap(chunk->memory, chunk->size);
+    worker->buffers_count -= chunk->count;
+    worker->buffers_chunks_count--;
+    worker->buffers_shrinks++;
+    return chunk->count;
+}
 
-    return 0;
+static inline int32_t transport_worker_pop_default_buffer(transport_worker_t* worker)
+{
+    int32_t buffer_id = transport_buffers_pool_pop(&worker->buffer_classes[0].free_buffers);
+    if (unlikely(buffer_id == TRANSPORT_BUFFER_USED) && worker->buffers_capacity > worker->static_buffers_count)
+    {
+        if (transport_worker_grow_buffers(worker) > 0)
+        {
+            buffer_id = transport_buffers_pool_pop(&worker->buffer_classes[0].free_buffers);
+        }
+    }
+    return buffer_id;
 }
 
 int32_t transport_worker_get_buffer(transport_worker_t* worker)
 {
-    return transport_buffers_pool_pop(&worker->free_buffers);
+    return transport_worker_pop_default_buffer(worker);
+}
+
+int32_t transport_worker_select_buffer_class(transport_worker_t* worker, uint32_t size)
+{
+    int32_t selected = -1;
+    int32_t largest = 0;
+    for (uint8_t index = 0; index < worker->buffer_classes_count; index++)
+    {
+        uint32_t class_size = worker->buffer_classes[index].size;
+        if (class_size >= size && (selected < 0 || class_size < worker->buffer_classes[selected].size))
+        {
+            selected = index;
+        }
+        if (class_size > worker->buffer_classes[largest].size)
+        {
+            largest = index;
+        }
+    }
+    return selected < 0 ? largest : selected;
+}
+
+int32_t transport_worker_get_buffer_sized(transport_worker_t* worker, uint32_t size)
+{
+    int32_t selected = transport_worker_select_buffer_class(worker, size);
+    int32_t buffer_id = selected ? transport_buffers_pool_pop(&worker->buffer_classes[selected].free_buffers) : transport_worker_pop_default_buffer(worker);
+    if (likely(buffer_id != TRANSPORT_BUFFER_USED))
+    {
+        return buffer_id;
+    }
+    int32_t fallback = -1;
+    for (uint8_t index = 0; index < worker->buffer_classes_count; index++)
+    {
+        struct transport_buffers_class* buffer_class = &worker->buffer_classes[index];
+        if (buffer_class->free_buffers.count &&
+            buffer_class->size > worker->buffer_classes[selected].size &&
+            (fallback < 0 || buffer_class->size < worker->buffer_classes[fallback].size))
+        {
+            fallback = index;
+        }
+    }
+    return fallback < 0 ? TRANSPORT_BUFFER_USED : transport_buffers_pool_pop(&worker->buffer_classes[fallback].free_buffers);
+}
+
+static inline struct transport_buffers_class* transport_worker_buffer_class(transport_worker_t* worker, uint32_t buffer_id)
+{
+    if (buffer_id >= worker->static_buffers_count)
+    {
+        return &worker->buffer_classes[0];
+    }
+    uint8_t index = worker->buffer_classes_count - 1;
+    while (index && buffer_id < worker->buffer_classes[index].first)
+    {
+        index--;
+    }
+    return &worker->buffer_classes[index];
 }
 
 int32_t transport_worker_available_buffers(transport_worker_t* worker)
 {
-    return worker->free_buffers.count;
+    int32_t available = 0;
+    for (uint8_t index = 0; index < worker->buffer_classes_count; index++)
+    {
+        available += worker->buffer_classes[index].free_buffers.count;
+    }
+    return available;
+}
+
+int32_t transport_worker_used_buffers(transport_worker_t* worker)
+{
+    return worker->buffers_count - worker->provided_buffers_count - transport_worker_available_buffers(worker);
+}
+
+int32_t transport_worker_available_class_buffers(transport_worker_t* worker, uint8_t buffer_class)
+{
+    return buffer_class < worker->buffer_classes_count ? worker->buffer_classes[buffer_class].free_buffers.count : 0;
+}
+
+int32_t transport_worker_used_class_buffers(transport_worker_t* worker, uint8_t buffer_class)
+{
+    if (buffer_class >= worker->buffer_classes_count)
+    {
+        return 0;
+    }
+    int32_t provided = buffer_class ? 0 : worker->provided_buffers_count;
+    int32_t grown = buffer_class ? 0 : worker->buffers_count - worker->static_buffers_count;
+    return worker->buffer_classes[buffer_class].count + grown - provided - worker->buffer_classes[buffer_class].free_buffers.count;
+}
+
+void transport_worker_release_buffer(transport_worker_t* worker, uint32_t buffer_id)
+{
+    if (unlikely(!transport_buffers_unreference(worker->buffer_references, buffer_id)))
+    {
+        return;
+    }
+    struct iovec* buffer = &worker->buffers[buffer_id];
+    struct transport_buffers_class* buffer_class = transport_worker_buffer_class(worker, buffer_id);
+    if (worker->zero_buffers)
+    {
+        memset(buffer->iov_base, 0, buffer_class->size);
+    }
+    buffer->iov_len = buffer_class->size;
+    if (buffer_id < worker->provided_buffers_count)
+    {
+        io_uring_buf_ring_add(worker->provided_buffers, buffer->iov_base, buffer_class->size, buffer_id, io_uring_buf_ring_mask(worker->provided_buffers_count), 0);
+        io_uring_buf_ring_advance(worker->provided_buffers, 1);
+        return;
+    }
+    transport_buffers_pool_push(&buffer_class->free_buffers, buffer_id);
+    if (unlikely(worker->buffers_chunks_count) && buffer_class == worker->buffer_classes)
+    {
+        transport_worker_shrink_buffers(worker);
+    }
+}
+
+int32_t transport_worker_share_buffer(transport_worker_t* worker, uint32_t buffer_id, uint32_t count)
+{
+    if (!worker->wide_tags)
+    {
+        return -ENOTSUP;
+    }
+    if (unlikely(buffer_id >= worker->buffers_count || buffer_id < worker->provided_buffers_count || count == 0))
+    {
+        return -EINVAL;
+    }
+    transport_buffers_share(worker->buffer_references, buffer_id, count);
+    return 0;
+}
+
+static inline uint8_t transport_worker_file_flags(transport_worker_t* worker, uint32_t fd)
+{
+    return fd < worker->registered_files_count && worker->registered_files[fd] ? IOSQE_FIXED_FILE : 0;
+}
+
+static inline bool transport_worker_link_timeout(transport_worker_t* worker, struct io_uring_sqe* sqe, int64_t timeout)
+{
+    struct io_uring_sqe* timeout_sqe;
+    if (!worker->link_timeouts || timeout == TRANSPORT_TIMEOUT_INFINITY || !(timeout_sqe = io_uring_get_sqe(worker->ring)))
+    {
+        return false;
+    }
+    struct __kernel_timespec* timeout_spec = &worker->link_timeout_specs[timeout_sqe - worker->ring->sq.sqes];
+    timeout_spec->tv_sec = timeout / 1000;
+    timeout_spec->tv_nsec = (timeout % 1000) * 1000000;
+    io_uring_prep_link_timeout(timeout_sqe, timeout_spec, 0);
+    io_uring_sqe_set_data64(timeout_sqe, TRANSPORT_EVENT_LINK_TIMEOUT);
+    timeout_sqe->flags |= IOSQE_CQE_SKIP_SUCCESS | (sqe->flags & IOSQE_IO_LINK);
+    sqe->flags |= IOSQE_IO_LINK;
+    return true;
+}
+
+static inline void transport_worker_arm_timeouts(transport_worker_t* worker)
+{
+    struct io_uring_sqe* sqe;
+    if (!worker->link_timeouts || worker->io_thread || worker->timeouts_armed || !worker->timeouts.count || !(sqe = io_uring_get_sqe(worker->ring)))
+    {
+        return;
+    }
+    struct __kernel_timespec* timeout_spec = &worker->link_timeout_specs[sqe - worker->ring->sq.sqes];
+    timeout_spec->tv_sec = worker->timeout_checker_period_millis / 1000;
+    timeout_spec->tv_nsec = (worker->timeout_checker_period_millis % 1000) * 1000000;
+    io_uring_prep_timeout(sqe, timeout_spec, 0, 0);
+    io_uring_sqe_set_data64(sqe, TRANSPORT_EVENT_TIMEOUTS_TICK);
+    worker->timeouts_armed = true;
+}
+
+static inline void transport_worker_submit_parked(transport_worker_t* worker)
+{
+    if (unlikely(worker->parked && !worker->io_thread && !worker->chaining))
+    {
+        io_uring_submit(worker->ring);
+    }
+}
+
+static inline void transport_worker_release_event(transport_worker_t* worker, struct transport_event* event)
+{
+    if (event->timeout != TRANSPORT_TIMEOUTS_NONE)
+    {
+        transport_timeouts_remove(&worker->timeouts, event->timeout);
+    }
+    if (event->link != TRANSPORT_FD_EVENTS_NONE)
+    {
+        transport_fd_events_remove(&worker->fd_events, event->link);
+    }
+}
+
+static inline void transport_worker_delete_event(transport_worker_t* worker, struct transport_event* event)
+{
+    transport_worker_release_event(worker, event);
+    transport_events_remove(event);
+}
+
+static inline uint64_t transport_worker_tag(transport_worker_t* worker, uint32_t fd, uint32_t buffer_id, uint16_t event)
+{
+    if (worker->wide_tags)
+    {
+        return transport_tags_acquire(&worker->tags, fd, buffer_id, event);
+    }
+    return ((uint64_t)(fd) << 32) | ((uint64_t)(buffer_id) << 16) | ((uint64_t)event);
+}
+
+static inline uint16_t transport_worker_event_code(transport_worker_t* worker, uint64_t data)
+{
+    if (worker->wide_tags)
+    {
+        struct transport_tag* tag = transport_tags_resolve(&worker->tags, data);
+        return tag ? tag->code : 0;
+    }
+    return data & 0xffff;
+}
+
+static inline bool transport_worker_untag(transport_worker_t* worker, struct io_uring_cqe* cqe, uint32_t* fd, uint32_t* buffer_id, uint16_t* event)
+{
+    uint64_t data = cqe->user_data;
+    if (worker->wide_tags)
+    {
+        struct transport_tag* tag = transport_tags_resolve(&worker->tags, data);
+        if (unlikely(tag == NULL))
+        {
+            return false;
+        }
+        *fd = tag->fd;
+        *buffer_id = tag->buffer_id;
+        *event = tag->code;
+    }
+    else
+    {
+        *fd = data >> 32;
+        *buffer_id = (data >> 16) & 0xffff;
+        *event = data & 0xffff;
+    }
+    if (cqe->flags & IORING_CQE_F_BUFFER)
+    {
+        *buffer_id = cqe->flags >> IORING_CQE_BUFFER_SHIFT;
+    }
+    return true;
+}
+
+static inline struct transport_event* transport_worker_event_slot(transport_worker_t* worker, uint64_t data)
+{
+    if (worker->wide_tags)
+    {
+        struct transport_tag* tag = transport_tags_resolve(&worker->tags, data);
+        return tag ? &tag->event : NULL;
+    }
+    return transport_events_slot(&worker->events, data);
+}
+
+static inline struct transport_event* transport_worker_find_event(transport_worker_t* worker, uint64_t data)
+{
+    if (worker->wide_tags)
+    {
+        struct transport_tag* tag = transport_tags_resolve(&worker->tags, data);
+        return tag && tag->event.data == data ? &tag->event : NULL;
+    }
+    return transport_events_find(&worker->events, data);
+}
+
+static inline void transport_worker_forget(transport_worker_t* worker, uint64_t data)
+{
+    transport_worker_remove_event(worker, data);
+    struct transport_tag* tag;
+    if (worker->wide_tags && (tag = transport_tags_resolve(&worker->tags, data)))
+    {
+        transport_tags_release(&worker->tags, tag);
+    }
+}
+
+static inline void transport_worker_retire(transport_worker_t* worker, struct io_uring_cqe* cqe)
+{
+    uint64_t data = cqe->user_data;
+    if (cqe->flags & IORING_CQE_F_MORE)
+    {
+        transport_worker_touch_event(worker, data);
+        return;
+    }
+    transport_worker_forget(worker, data);
+}
+
+static inline void transport_worker_add_event(transport_worker_t* worker, struct io_uring_sqe* sqe, int fd, uint64_t data, int64_t timeout)
+{
+    struct transport_event* event = transport_worker_event_slot(worker, data);
+    if (unlikely(event == NULL))
+    {
+        return;
+    }
+    if (unlikely(event->data != TRANSPORT_EVENTS_EMPTY))
+    {
+        transport_worker_release_event(worker, event);
+    }
+    event->data = data;
+    event->timeout = timeout == TRANSPORT_TIMEOUT_INFINITY || (sqe && transport_worker_link_timeout(worker, sqe, timeout))
+                         ? TRANSPORT_TIMEOUTS_NONE
+                         : transport_timeouts_add(&worker->timeouts, data, transport_timeouts_now(), timeout);
+    event->link = transport_fd_events_add(&worker->fd_events, fd, data);
+    transport_worker_submit_parked(worker);
+}
+
+static inline int transport_worker_prep_write(transport_worker_t* worker,
+                                              uint32_t fd,
+                                              uint32_t buffer_id,
+                                              uint32_t offset,
+                                              int64_t timeout,
+                                              uint16_t event,
+                                              uint8_t sqe_flags)
+{
+    struct io_uring* ring = worker->ring;
+    uint64_t data = transport_worker_tag(worker, fd, buffer_id, event);
+    if (unlikely(data == TRANSPORT_EVENTS_EMPTY))
+    {
+        return -ENOMEM;
+    }
+    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
+    struct iovec* buffer = &worker->buffers[buffer_id];
+    if (likely(buffer_id < worker->registered_buffers_count))
+    {
+        io_uring_prep_write_fixed(sqe, fd, buffer->iov_base, buffer->iov_len, offset, buffer_id);
+    }
+    else
+    {
+        io_uring_prep_write(sqe, fd, buffer->iov_base, buffer->iov_len, offset);
+    }
+    io_uring_sqe_set_data64(sqe, data);
+    sqe->flags |= sqe_flags | transport_worker_file_flags(worker, fd);
+    transport_worker_add_event(worker, sqe, fd, data, timeout);
+    return 0;
+}
+
+static inline int transport_worker_prep_write_vector(transport_worker_t* worker,
+                                                     uint32_t fd,
+                                                     uint32_t buffer_id,
+                                                     uint16_t event,
+                                                     uint8_t sqe_flags)
+{
+    struct io_uring* ring = worker->ring;
+    struct transport_vector* vector = &worker->vectors.entries[buffer_id];
+    uint64_t data = transport_worker_tag(worker, fd, buffer_id, event | TRANSPORT_EVENT_VECTOR);
+    if (unlikely(data == TRANSPORT_EVENTS_EMPTY))
+    {
+        return -ENOMEM;
+    }
+    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
+    io_uring_prep_writev(sqe, fd, vector->iovecs + vector->index, vector->count - vector->index, vector->offset);
+    io_uring_sqe_set_data64(sqe, data);
+    sqe->flags |= sqe_flags | transport_worker_file_flags(worker, fd);
+    transport_worker_add_event(worker, sqe, fd, data, vector->timeout);
+    return 0;
+}
+
+static inline int transport_worker_prep_read(transport_worker_t* worker,
+                                             uint32_t fd,
+                                             uint32_t buffer_id,
+                                             uint32_t offset,
+                                             int64_t timeout,
+                                             uint16_t event,
+                                             uint8_t sqe_flags)
+{
+    struct io_uring* ring = worker->ring;
+    uint64_t data = transport_worker_tag(worker, fd, buffer_id, event);
+    if (unlikely(data == TRANSPORT_EVENTS_EMPTY))
+    {
+        return -ENOMEM;
+    }
+    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
+    struct iovec* buffer = &worker->buffers[buffer_id];
+    if (likely(buffer_id < worker->registered_buffers_count))
+    {
+        io_uring_prep_read_fixed(sqe, fd, buffer->iov_base, buffer->iov_len, offset, buffer_id);
+    }
+    else
+    {
+        io_uring_prep_read(sqe, fd, buffer->iov_base, buffer->iov_len, offset);
+    }
+    io_uring_sqe_set_data64(sqe, data);
+    sqe->flags |= sqe_flags | transport_worker_file_flags(worker, fd);
+    transport_worker_add_event(worker, sqe, fd, data, timeout);
+    return 0;
+}
+
+static inline int transport_worker_prep_send_zero_copy(transport_worker_t* worker,
+                                                       uint32_t fd,
+                                                       uint32_t buffer_id,
+                                                       int64_t timeout,
+                                                       uint16_t event,
+                                                       uint8_t sqe_flags)
+{
+    struct io_uring* ring = worker->ring;
+    uint64_t data = transport_worker_tag(worker, fd, buffer_id, event);
+    if (unlikely(data == TRANSPORT_EVENTS_EMPTY))
+    {
+        return -ENOMEM;
+    }
+    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
+    struct iovec* buffer = &worker->buffers[buffer_id];
+    if (likely(buffer_id < worker->registered_buffers_count))
+    {
+        io_uring_prep_send_zc_fixed(sqe, fd, buffer->iov_base, buffer->iov_len, MSG_WAITALL, 0, buffer_id);
+    }
+    else
+    {
+        io_uring_prep_send_zc(sqe, fd, buffer->iov_base, buffer->iov_len, MSG_WAITALL, 0);
+    }
+    io_uring_sqe_set_data64(sqe, data);
+    sqe->flags |= sqe_flags | transport_worker_file_flags(worker, fd);
+    transport_worker_add_event(worker, sqe, fd, data, timeout);
+    return 0;
+}
+
+static inline struct msghdr* transport_worker_prepare_send_message(transport_worker_t* worker,
+                                                                   uint32_t buffer_id,
+                                                                   struct sockaddr* address,
+                                                                   transport_socket_family_t socket_family)
+{
+    struct msghdr* message;
+    if (socket_family == INET)
+    {
+        message = &worker->inet_used_messages[buffer_id];
+        memcpy(message->msg_name, address, message->msg_namelen);
+    }
+    if (socket_family == UNIX)
+    {
+        message = &worker->unix_used_messages[buffer_id];
+        message->msg_namelen = SUN_LEN((struct sockaddr_un*)address);
+        memcpy(message->msg_name, address, message->msg_namelen);
+    }
+    message->msg_control = NULL;
+    message->msg_controllen = 0;
+    message->msg_iov = &worker->buffers[buffer_id];
+    message->msg_iovlen = 1;
+    message->msg_flags = 0;
+    return message;
+}
+
+static inline int transport_worker_prep_send_message(transport_worker_t* worker,
+                                                     uint32_t fd,
+                                                     uint32_t buffer_id,
+                                                     struct sockaddr* address,
+                                                     transport_socket_family_t socket_family,
+                                                     int message_flags,
+                                                     int64_t timeout,
+                                                     uint16_t event,
+                                                     uint8_t sqe_flags)
+{
+    struct io_uring* ring = worker->ring;
+    uint64_t data = transport_worker_tag(worker, fd, buffer_id, event);
+    if (unlikely(data == TRANSPORT_EVENTS_EMPTY))
+    {
+        return -ENOMEM;
+    }
+    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
+    struct msghdr* message = transport_worker_prepare_send_message(worker, buffer_id, address, socket_family);
+    io_uring_prep_sendmsg(sqe, fd, message, message_flags);
+    io_uring_sqe_set_data64(sqe, data);
+    sqe->flags |= sqe_flags | transport_worker_file_flags(worker, fd);
+    transport_worker_add_event(worker, sqe, fd, data, timeout);
+    return 0;
+}
+
+static inline int transport_worker_prep_send_message_zero_copy(transport_worker_t* worker,
+                                                               uint32_t fd,
+                                                               uint32_t buffer_id,
+                                                               struct sockaddr* address,
+                                                               transport_socket_family_t socket_family,
+                                                               int message_flags,
+                                                               int64_t timeout,
+                                                               uint16_t event,
+                                                               uint8_t sqe_flags)
+{
+    struct io_uring* ring = worker->ring;
+    uint64_t data = transport_worker_tag(worker, fd, buffer_id, event);
+    if (unlikely(data == TRANSPORT_EVENTS_EMPTY))
+    {
+        return -ENOMEM;
+    }
+    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
+    struct msghdr* message = transport_worker_prepare_send_message(worker, buffer_id, address, socket_family);
+    io_uring_prep_sendmsg_zc(sqe, fd, message, message_flags);
+    io_uring_sqe_set_data64(sqe, data);
+    sqe->flags |= sqe_flags | transport_worker_file_flags(worker, fd);
+    transport_worker_add_event(worker, sqe, fd, data, timeout);
+    return 0;
+}
+
+static inline int transport_worker_prep_receive_message(transport_worker_t* worker,
+                                                        uint32_t fd,
+                                                        uint32_t buffer_id,
+                                                        transport_socket_family_t socket_family,
+                                                        int message_flags,
+                                                        int64_t timeout,
+                                                        uint16_t event,
+                                                        uint8_t sqe_flags)
+{
+    struct io_uring* ring = worker->ring;
+    uint64_t data = transport_worker_tag(worker, fd, buffer_id, event);
+    if (unlikely(data == TRANSPORT_EVENTS_EMPTY))
+    {
+        return -ENOMEM;
+    }
+    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
+    struct msghdr* message;
+    if (socket_family == INET)
+    {
+        message = &worker->inet_used_messages[buffer_id];
+        message->msg_namelen = sizeof(struct sockaddr_in);
+    }
+    if (socket_family == UNIX)
+    {
+        message = &worker->unix_used_messages[buffer_id];
+        message->msg_namelen = sizeof(struct sockaddr_un);
+    }
+    message->msg_control = NULL;
+    message->msg_controllen = 0;
+    memset(message->msg_name, 0, message->msg_namelen);
+    message->msg_iov = &worker->buffers[buffer_id];
+    message->msg_iovlen = 1;
+    message->msg_flags = 0;
+    io_uring_prep_recvmsg(sqe, fd, message, message_flags);
+    io_uring_sqe_set_data64(sqe, data);
+    sqe->flags |= sqe_flags | transport_worker_file_flags(worker, fd);
+    transport_worker_add_event(worker, sqe, fd, data, timeout);
+    return 0;
+}
+
+static inline int transport_worker_prep_read_multishot(transport_worker_t* worker,
+                                                       uint32_t fd,
+                                                       int64_t timeout,
+                                                       uint16_t event,
+                                                       uint8_t sqe_flags)
+{
+    struct io_uring* ring = worker->ring;
+    uint64_t data = transport_worker_tag(worker, fd, 0, event);
+    if (unlikely(data == TRANSPORT_EVENTS_EMPTY))
+    {
+        return -ENOMEM;
+    }
+    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
+    io_uring_prep_recv_multishot(sqe, fd, NULL, 0, 0);
+    io_uring_sqe_set_data64(sqe, data);
+    sqe->flags |= IOSQE_BUFFER_SELECT | sqe_flags | transport_worker_file_flags(worker, fd);
+    sqe->buf_group = TRANSPORT_PROVIDED_BUFFERS_GROUP;
+    transport_worker_add_event(worker, NULL, fd, data, timeout);
+    return 0;
+}
+
+static inline int transport_worker_prep_splice(transport_worker_t* worker, uint32_t id)
+{
+    struct transport_splice* splice = &worker->splices.entries[id];
+    uint32_t length = splice->buffered;
+    uint64_t input = TRANSPORT_EVENTS_EMPTY;
+    if (length == 0 && unlikely((input = transport_worker_tag(worker, splice->fd, id, splice->event | TRANSPORT_EVENT_SPLICE_INPUT)) == TRANSPORT_EVENTS_EMPTY))
+    {
+        return -ENOMEM;
+    }
+    uint64_t data = transport_worker_tag(worker, splice->fd, id, splice->event);
+    if (unlikely(data == TRANSPORT_EVENTS_EMPTY))
+    {
+        if (input != TRANSPORT_EVENTS_EMPTY)
+        {
+            transport_worker_forget(worker, input);
+        }
+        return -ENOMEM;
+    }
+    if (length == 0)
+    {
+        length = splice->remaining < splice->chunk_size ? (uint32_t)splice->remaining : splice->chunk_size;
+        struct io_uring_sqe* sqe = transport_provide_sqe(worker->ring);
+        unsigned int flags = SPLICE_F_MOVE | (transport_worker_file_flags(worker, splice->source_fd) ? SPLICE_F_FD_IN_FIXED : 0);
+        io_uring_prep_splice(sqe, splice->source_fd, (int64_t)splice->offset, splice->pipe[1], -1, length, flags);
+        io_uring_sqe_set_data64(sqe, input);
+        sqe->flags |= IOSQE_IO_LINK;
+        splice->requested = length;
+        bool chaining = worker->chaining;
+        worker->chaining = true;
+        transport_worker_add_event(worker, sqe, splice->fd, input, splice->timeout);
+        worker->chaining = chaining;
+    }
+    struct io_uring_sqe* sqe = transport_provide_sqe(worker->ring);
+    io_uring_prep_splice(sqe, splice->pipe[0], -1, splice->fd, -1, length, SPLICE_F_MOVE);
+    io_uring_sqe_set_data64(sqe, data);
+    sqe->flags |= transport_worker_file_flags(worker, splice->fd);
+    transport_worker_add_event(worker, sqe, splice->fd, data, splice->timeout);
+    return 0;
+}
+
+static inline int transport_worker_prep_proxy(transport_worker_t* worker, uint32_t id)
+{
+    struct transport_splice* splice = &worker->splices.entries[id];
+    if (splice->buffered == 0)
+    {
+        uint64_t poll = transport_worker_tag(worker, splice->source_fd, id, splice->event | TRANSPORT_EVENT_SPLICE_INPUT | TRANSPORT_EVENT_SPLICE_POLL);
+        if (unlikely(poll == TRANSPORT_EVENTS_EMPTY))
+        {
+            return -ENOMEM;
+        }
+        uint64_t data = transport_worker_tag(worker, splice->source_fd, id, splice->event | TRANSPORT_EVENT_SPLICE_INPUT);
+        if (unlikely(data == TRANSPORT_EVENTS_EMPTY))
+        {
+            transport_worker_forget(worker, poll);
+            return -ENOMEM;
+        }
+        uint8_t fixed = transport_worker_file_flags(worker, splice->source_fd);
+        struct io_uring_sqe* sqe = transport_provide_sqe(worker->ring);
+        splice->poll = poll;
+        io_uring_prep_poll_add(sqe, splice->source_fd, POLLIN);
+        io_uring_sqe_set_data64(sqe, poll);
+        sqe->flags |= IOSQE_IO_LINK | IOSQE_CQE_SKIP_SUCCESS | fixed;
+        bool chaining = worker->chaining;
+        worker->chaining = true;
+        transport_worker_add_event(worker, NULL, splice->source_fd, poll, TRANSPORT_TIMEOUT_INFINITY);
+        worker->chaining = chaining;
+        sqe = transport_provide_sqe(worker->ring);
+        io_uring_prep_splice(sqe, splice->source_fd, -1, splice->pipe[1], -1, splice->chunk_size, SPLICE_F_MOVE | (fixed ? SPLICE_F_FD_IN_FIXED : 0));
+        io_uring_sqe_set_data64(sqe, data);
+        transport_worker_add_event(worker, NULL, splice->source_fd, data, TRANSPORT_TIMEOUT_INFINITY);
+        return 0;
+    }
+    uint64_t data = transport_worker_tag(worker, splice->fd, id, splice->event);
+    if (unlikely(data == TRANSPORT_EVENTS_EMPTY))
+    {
+        return -ENOMEM;
+    }
+    struct io_uring_sqe* sqe = transport_provide_sqe(worker->ring);
+    io_uring_prep_splice(sqe, splice->pipe[0], -1, splice->fd, -1, splice->buffered, SPLICE_F_MOVE);
+    io_uring_sqe_set_data64(sqe, data);
+    sqe->flags |= transport_worker_file_flags(worker, splice->fd);
+    transport_worker_add_event(worker, NULL, splice->fd, data, TRANSPORT_TIMEOUT_INFINITY);
+    return 0;
+}
+
+static inline int transport_worker_prep_connect(transport_worker_t* worker, transport_client_t* client, int64_t timeout)
+{
+    struct io_uring* ring = worker->ring;
+    uint64_t data = transport_worker_tag(worker, client->fd, 0, TRANSPORT_EVENT_CONNECT | TRANSPORT_EVENT_CLIENT);
+    if (unlikely(data == TRANSPORT_EVENTS_EMPTY))
+    {
+        return -ENOMEM;
+    }
+    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
+    struct sockaddr* address = client->family == INET
+                                   ? (struct sockaddr*)&client->inet_destination_address
+                                   : (struct sockaddr*)&client->unix_destination_address;
+    io_uring_prep_connect(sqe, client->fd, address, client->client_address_length);
+    io_uring_sqe_set_data64(sqe, data);
+    sqe->flags |= transport_worker_file_flags(worker, client->fd);
+    transport_worker_add_event(worker, sqe, client->fd, data, timeout);
+    return 0;
+}
+
+static inline int transport_worker_prep_accept(transport_worker_t* worker, transport_server_t* server)
+{
+    struct io_uring* ring = worker->ring;
+    uint64_t data = transport_worker_tag(worker, server->fd, 0, TRANSPORT_EVENT_ACCEPT | TRANSPORT_EVENT_SERVER);
+    if (unlikely(data == TRANSPORT_EVENTS_EMPTY))
+    {
+        return -ENOMEM;
+    }
+    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
+    struct sockaddr* address = server->family == INET
+                                   ? (struct sockaddr*)&server->inet_server_address
+                                   : (struct sockaddr*)&server->unix_server_address;
+    io_uring_prep_accept(sqe, server->fd, address, &server->server_address_length, 0);
+    io_uring_sqe_set_data64(sqe, data);
+    transport_worker_add_event(worker, NULL, server->fd, data, TRANSPORT_TIMEOUT_INFINITY);
+    return 0;
+}
+
+static inline int transport_worker_prep_accept_multishot(transport_worker_t* worker, transport_server_t* server)
+{
+    struct io_uring* ring = worker->ring;
+    uint64_t data = transport_worker_tag(worker, server->fd, 0, TRANSPORT_EVENT_ACCEPT | TRANSPORT_EVENT_SERVER);
+    if (unlikely(data == TRANSPORT_EVENTS_EMPTY))
+    {
+        return -ENOMEM;
+    }
+    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
+    io_uring_prep_multishot_accept(sqe, server->fd, NULL, NULL, 0);
+    io_uring_sqe_set_data64(sqe, data);
+    transport_worker_add_event(worker, NULL, server->fd, data, TRANSPORT_TIMEOUT_INFINITY);
+    return 0;
+}
+
+int transport_worker_register_file(transport_worker_t* worker, int fd)
+{
+    if (fd < 0 || (uint32_t)fd >= worker->registered_files_count)
+    {
+        return 0;
+    }
+    int result = io_uring_register_files_update(worker->ring, fd, &fd, 1);
+    if (result < 0)
+    {
+        return result;
+    }
+    worker->registered_files[fd] = true;
+    return 0;
+}
+
+void transport_worker_unregister_file(transport_worker_t* worker, int fd)
+{
+    if (fd < 0 || (uint32_t)fd >= worker->registered_files_count || !worker->registered_files[fd])
+    {
+        return;
+    }
+    int empty = -1;
+    io_uring_register_files_update(worker->ring, fd, &empty, 1);
+    worker->registered_files[fd] = false;
+}
+
+static inline void transport_worker_prep_cancel_event(transport_worker_t* worker, uint64_t data)
+{
+    struct io_uring_sqe* sqe = transport_provide_sqe(worker->ring);
+    io_uring_prep_cancel64(sqe, data, IORING_ASYNC_CANCEL_ALL);
+    sqe->flags |= IOSQE_CQE_SKIP_SUCCESS;
+}
+
+static inline void transport_worker_prep_cancel_by_fd(transport_worker_t* worker, int fd)
+{
+    uint32_t link = transport_fd_events_head(&worker->fd_events, fd);
+    if (link == TRANSPORT_FD_EVENTS_NONE)
+    {
+        return;
+    }
+    uint32_t required = 1;
+    for (uint32_t index = link; index != TRANSPORT_FD_EVENTS_NONE; index = worker->fd_events.entries[index].next)
+    {
+        if (transport_worker_event_code(worker, worker->fd_events.entries[index].data) & TRANSPORT_EVENT_SPLICE_INPUT)
+        {
+            required++;
+        }
+    }
+    if (io_uring_sq_space_left(worker->ring) < required)
+    {
+        io_uring_submit(worker->ring);
+    }
+    while (link != TRANSPORT_FD_EVENTS_NONE)
+    {
+        uint32_t next = worker->fd_events.entries[link].next;
+        uint64_t data = worker->fd_events.entries[link].data;
+        struct transport_event* event;
+        if ((event = transport_worker_find_event(worker, data)))
+        {
+            if (transport_worker_event_code(worker, data) & TRANSPORT_EVENT_SPLICE_INPUT)
+            {
+                transport_worker_prep_cancel_event(worker, data);
+            }
+            transport_worker_delete_event(worker, event);
+        }
+        link = next;
+    }
+    struct io_uring_sqe* sqe = transport_provide_sqe(worker->ring);
+    bool fixed = transport_worker_file_flags(worker, fd);
+    io_uring_prep_cancel_fd(sqe, fd, IORING_ASYNC_CANCEL_ALL | (fixed ? IORING_ASYNC_CANCEL_FD_FIXED : 0));
+    sqe->flags |= IOSQE_CQE_SKIP_SUCCESS;
+    io_uring_submit(worker->ring);
+}
+
+static inline void transport_worker_prep_cancel_proxy(transport_worker_t* worker, uint32_t id)
+{
+    struct transport_splice* splice = &worker->splices.entries[id];
+    transport_worker_prep_cancel_by_fd(worker, splice->source_fd);
+    transport_worker_prep_cancel_by_fd(worker, splice->fd);
+}
+
+static inline void transport_worker_wake_io_thread(transport_worker_t* worker)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&worker->io_thread_sleeping, __ATOMIC_RELAXED))
+    {
+        eventfd_write(worker->io_thread_wakeup_fd, 1);
+    }
+}
+
+static inline void transport_worker_push_operation(transport_worker_t* worker, struct transport_worker_operation* operation)
+{
+    while (unlikely(!transport_queue_push(&worker->submissions, operation)))
+    {
+        transport_worker_wake_io_thread(worker);
+        sched_yield();
+    }
+    transport_worker_wake_io_thread(worker);
+}
+
+static inline void transport_worker_prep_io_thread_wakeup(transport_worker_t* worker)
+{
+    struct io_uring_sqe* sqe = transport_provide_sqe(worker->ring);
+    io_uring_prep_read(sqe, worker->io_thread_wakeup_fd, &worker->io_thread_wakeup_value, sizeof(worker->io_thread_wakeup_value), 0);
+    io_uring_sqe_set_data64(sqe, TRANSPORT_EVENT_WAKEUP);
+}
+
+static inline void transport_worker_execute_operation(transport_worker_t* worker, struct transport_worker_operation* operation)
+{
+    int result = 0;
+    switch (operation->code)
+    {
+        case TRANSPORT_OPERATION_WRITE:
+            result = transport_worker_prep_write(worker, operation->fd, operation->buffer_id, operation->offset, operation->timeout, operation->event, operation->sqe_flags);
+            break;
+        case TRANSPORT_OPERATION_WRITE_VECTOR:
+            result = transport_worker_prep_write_vector(worker, operation->fd, operation->buffer_id, operation->event, operation->sqe_flags);
+            break;
+        case TRANSPORT_OPERATION_READ:
+            result = transport_worker_prep_read(worker, operation->fd, operation->buffer_id, operation->offset, operation->timeout, operation->event, operation->sqe_flags);
+            break;
+        case TRANSPORT_OPERATION_SEND_ZERO_COPY:
+            result = transport_worker_prep_send_zero_copy(worker, operation->fd, operation->buffer_id, operation->timeout, operation->event, operation->sqe_flags);
+            break;
+        case TRANSPORT_OPERATION_SEND_MESSAGE:
+            result = transport_worker_prep_send_message(worker,
+                                                        operation->fd,
+                                                        operation->buffer_id,
+                                                        operation->pointer,
+                                                        operation->socket_family,
+                                                        operation->message_flags,
+                                                        operation->timeout,
+                                                        operation->event,
+                                                        operation->sqe_flags);
+            break;
+        case TRANSPORT_OPERATION_SEND_MESSAGE_ZERO_COPY:
+            result = transport_worker_prep_send_message_zero_copy(worker,
+                                                                  operation->fd,
+                                                                  operation->buffer_id,
+                                                                  operation->pointer,
+                                                                  operation->socket_family,
+                                                                  operation->message_flags,
+                                                                  operation->timeout,
+                                                                  operation->event,
+                                                                  operation->sqe_flags);
+            break;
+        case TRANSPORT_OPERATION_RECEIVE_MESSAGE:
+            result = transport_worker_prep_receive_message(worker,
+                                                           operation->fd,
+                                                           operation->buffer_id,
+                                                           operation->socket_family,
+                                                           operation->message_flags,
+                                                           operation->timeout,
+                                                           operation->event,
+                                                           operation->sqe_flags);
+            break;
+        case TRANSPORT_OPERATION_READ_MULTISHOT:
+            result = transport_worker_prep_read_multishot(worker, operation->fd, operation->timeout, operation->event, operation->sqe_flags);
+            break;
+        case TRANSPORT_OPERATION_SPLICE:
+        {
+            struct transport_splice* splice = &worker->splices.entries[operation->buffer_id];
+            if (unlikely(result = splice->proxy ? transport_worker_prep_proxy(worker, operation->buffer_id) : transport_worker_prep_splice(worker, operation->buffer_id)))
+            {
+                transport_worker_fail_operation(worker, splice->fd, operation->buffer_id, splice->event, result);
+            }
+            return;
+        }
+        case TRANSPORT_OPERATION_CONNECT:
+            if (unlikely(result = transport_worker_prep_connect(worker, operation->pointer, operation->timeout)))
+            {
+                transport_worker_fail_operation(worker, ((transport_client_t*)operation->pointer)->fd, 0, TRANSPORT_EVENT_CONNECT | TRANSPORT_EVENT_CLIENT, result);
+            }
+            return;
+        case TRANSPORT_OPERATION_ACCEPT:
+            if (unlikely(result = transport_worker_prep_accept(worker, operation->pointer)))
+            {
+                transport_worker_fail_operation(worker, ((transport_server_t*)operation->pointer)->fd, 0, TRANSPORT_EVENT_ACCEPT | TRANSPORT_EVENT_SERVER, result);
+            }
+            return;
+        case TRANSPORT_OPERATION_ACCEPT_MULTISHOT:
+            if (unlikely(result = transport_worker_prep_accept_multishot(worker, operation->pointer)))
+            {
+                transport_worker_fail_operation(worker, ((transport_server_t*)operation->pointer)->fd, 0, TRANSPORT_EVENT_ACCEPT | TRANSPORT_EVENT_SERVER, result);
+            }
+            return;
+        case TRANSPORT_OPERATION_CANCEL_BY_FD:
+            transport_worker_prep_cancel_by_fd(worker, operation->fd);
+            break;
+        case TRANSPORT_OPERATION_CANCEL_EVENT:
+            transport_worker_prep_cancel_event(worker, operation->data);
+            break;
+        case TRANSPORT_OPERATION_CANCEL_PROXY:
+            transport_worker_prep_cancel_proxy(worker, operation->buffer_id);
+            break;
+        case TRANSPORT_OPERATION_ARM_WAKEUP:
+            transport_worker_prep_io_thread_wakeup(worker);
+            break;
+    }
+    if (unlikely(result))
+    {
+        transport_worker_fail_operation(worker, operation->fd, operation->buffer_id, operation->event, result);
+    }
+}
+
+static inline bool transport_worker_reserve_sqes(transport_worker_t* worker, uint32_t count)
+{
+    uint32_t required = count * TRANSPORT_OPERATION_MAX_SQES;
+    if (unlikely(required > worker->ring->sq.ring_entries))
+    {
+        required = worker->ring->sq.ring_entries;
+    }
+    if (likely(io_uring_sq_space_left(worker->ring) >= required))
+    {
+        return true;
+    }
+    io_uring_submit(worker->ring);
+    return io_uring_sq_space_left(worker->ring) >= required;
+}
+
+static inline uint32_t transport_worker_chain_length(transport_worker_t* worker)
+{
+    for (uint32_t index = 0; index < worker->backlog.count; index++)
+    {
+        struct transport_worker_operation* operation = transport_backlog_at(&worker->backlog, index);
+        if (!(operation->sqe_flags & IOSQE_IO_LINK))
+        {
+            return index + 1;
+        }
+    }
+    return 0;
+}
+
+static inline bool transport_worker_flush_backlog(transport_worker_t* worker)
+{
+    bool flushed = false;
+    uint32_t count;
+    while ((count = transport_worker_chain_length(worker)) && transport_worker_reserve_sqes(worker, count))
+    {
+        worker->chaining = count > 1;
+        for (uint32_t index = 0; index < count; index++)
+        {
+            transport_worker_execute_operation(worker, transport_backlog_peek(&worker->backlog));
+            transport_backlog_pop(&worker->backlog);
+        }
+        worker->chaining = false;
+        if (count > 1)
+        {
+            transport_worker_submit_parked(worker);
+        }
+        flushed = true;
+    }
+    return flushed;
+}
+
+static inline void transport_worker_submit_operation(transport_worker_t* worker, struct transport_worker_operation* operation)
+{
+    bool linked = operation->sqe_flags & IOSQE_IO_LINK;
+    if (unlikely(worker->backlog.count || linked || !transport_worker_reserve_sqes(worker, 1)))
+    {
+        while (unlikely(transport_backlog_push(&worker->backlog, operation)))
+        {
+            io_uring_submit_and_wait(worker->ring, 1);
+            transport_worker_flush_backlog(worker);
+        }
+        if (!linked)
+        {
+            transport_worker_flush_backlog(worker);
+        }
+        return;
+    }
+    transport_worker_execute_operation(worker, operation);
+    if (unlikely(io_uring_sq_ready(worker->ring) >= worker->submit_threshold))
+    {
+        io_uring_submit(worker->ring);
+    }
+}
+
+static inline bool transport_worker_continue_vector(transport_worker_t* worker,
+                                                    struct io_uring_cqe* cqe,
+                                                    uint32_t fd,
+                                                    uint32_t buffer_id,
+                                                    uint16_t* event,
+                                                    int32_t* result)
+{
+    *event &= ~TRANSPORT_EVENT_VECTOR;
+    struct transport_vector* vector = &worker->vectors.entries[buffer_id];
+    if (cqe->res < 0)
+    {
+        return false;
+    }
+    if (cqe->res == 0 || vector->done + cqe->res >= vector->total)
+    {
+        *result = (int32_t)(vector->done + cqe->res);
+        return false;
+    }
+    transport_worker_retire(worker, cqe);
+    transport_vectors_advance(vector, cqe->res);
+    if (*event & TRANSPORT_EVENT_FILE)
+    {
+        vector->offset += cqe->res;
+    }
+    struct transport_worker_operation operation = {
+        .code = TRANSPORT_OPERATION_WRITE_VECTOR,
+        .fd = fd,
+        .buffer_id = buffer_id,
+        .event = *event,
+    };
+    transport_worker_submit_operation(worker, &operation);
+    return true;
+}
+
+static inline bool transport_worker_continue_proxy(transport_worker_t* worker,
+                                                   struct io_uring_cqe* cqe,
+                                                   uint32_t id,
+                                                   uint16_t* event,
+                                                   int32_t* result,
+                                                   uint32_t* flags)
+{
+    struct transport_splice* splice = &worker->splices.entries[id];
+    if (*event & TRANSPORT_EVENT_SPLICE_POLL)
+    {
+        splice->error = cqe->res;
+        splice->poll = TRANSPORT_EVENTS_EMPTY;
+        transport_worker_retire(worker, cqe);
+        return true;
+    }
+    bool input = *event & TRANSPORT_EVENT_SPLICE_INPUT;
+    *event &= ~TRANSPORT_EVENT_SPLICE_INPUT;
+    *flags = 0;
+    if (input && splice->poll != TRANSPORT_EVENTS_EMPTY)
+    {
+        transport_worker_forget(worker, splice->poll);
+        splice->poll = TRANSPORT_EVENTS_EMPTY;
+    }
+    bool closing = __atomic_load_n(&splice->closing, __ATOMIC_ACQUIRE);
+    if (cqe->res > 0)
+    {
+        if (input)
+        {
+            splice->buffered += cqe->res;
+        }
+        else
+        {
+            splice->buffered -= cqe->res;
+            __atomic_store_n(&splice->transferred, splice->transferred + cqe->res, __ATOMIC_RELAXED);
+        }
+    }
+    if (cqe->res > 0 && !closing)
+    {
+        transport_worker_retire(worker, cqe);
+        struct transport_worker_operation operation = {
+            .code = TRANSPORT_OPERATION_SPLICE,
+            .buffer_id = id,
+        };
+        transport_worker_submit_operation(worker, &operation);
+        return true;
+    }
+    *result = cqe->res > 0 ? -ECANCELED : cqe->res == -ECANCELED && splice->error ? splice->error : cqe->res;
+    if (cqe->res == 0 && input)
+    {
+        shutdown(splice->fd, SHUT_WR);
+        return false;
+    }
+    if (!closing && !__atomic_exchange_n(&worker->splices.entries[splice->peer].closing, true, __ATOMIC_ACQ_REL))
+    {
+        __atomic_store_n(&splice->closing, true, __ATOMIC_RELEASE);
+        struct transport_worker_operation operation = {
+            .code = TRANSPORT_OPERATION_CANCEL_PROXY,
+            .buffer_id = id,
+        };
+        transport_worker_submit_operation(worker, &operation);
+    }
+    return false;
+}
+
+static inline bool transport_worker_continue_splice(transport_worker_t* worker,
+                                                    struct io_uring_cqe* cqe,
+                                                    uint32_t id,
+                                                    uint16_t* event,
+                                                    int32_t* result,
+                                                    uint32_t* flags)
+{
+    struct transport_splice* splice = &worker->splices.entries[id];
+    if (splice->proxy)
+    {
+        return transport_worker_continue_proxy(worker, cqe, id, event, result, flags);
+    }
+    if (*event & TRANSPORT_EVENT_SPLICE_INPUT)
+    {
+        if (cqe->res < 0)
+        {
+            splice->error = cqe->res;
+        }
+        else
+        {
+            splice->offset += cqe->res;
+            splice->remaining = cqe->res ? splice->remaining - cqe->res : 0;
+            splice->buffered += cqe->res;
+            splice->broken = (uint32_t)cqe->res < splice->requested;
+        }
+        transport_worker_retire(worker, cqe);
+        return true;
+    }
+    *flags = 0;
+    if (cqe->res > 0)
+    {
+        *flags = splice->buffered > (uint32_t)cqe->res || splice->remaining ? IORING_CQE_F_MORE : 0;
+        return false;
+    }
+    if (cqe->res == -ECANCELED && splice->error)
+    {
+        *result = splice->error;
+        return false;
+    }
+    if (cqe->res == -ECANCELED && splice->broken)
+    {
+        splice->broken = false;
+        *result = 0;
+        if (splice->buffered == 0)
+        {
+            return false;
+        }
+        transport_worker_retire(worker, cqe);
+        struct transport_worker_operation operation = {
+            .code = TRANSPORT_OPERATION_SPLICE,
+            .buffer_id = id,
+        };
+        transport_worker_submit_operation(worker, &operation);
+        return true;
+    }
+    return false;
+}
+
+static inline void transport_worker_advance_splice(transport_worker_t* worker, uint32_t id, int32_t sent)
+{
+    worker->splices.entries[id].buffered -= sent;
+    worker->splices.entries[id].transferred += sent;
+    struct transport_worker_operation operation = {
+        .code = TRANSPORT_OPERATION_SPLICE,
+        .buffer_id = id,
+    };
+    transport_worker_submit_operation(worker, &operation);
+}
+
+static inline void transport_worker_finish_splice(transport_worker_t* worker, uint32_t id)
+{
+    if (!worker->splices.entries[id].proxy)
+    {
+        transport_splices_release(&worker->splices, id);
+    }
+}
+
+static inline void transport_worker_arm_io_thread_wakeup(transport_worker_t* worker)
+{
+    struct transport_worker_operation operation = {
+        .code = TRANSPORT_OPERATION_ARM_WAKEUP,
+    };
+    transport_worker_submit_operation(worker, &operation);
+}
+
+static inline void transport_worker_wake_parked(transport_worker_t* worker)
+{
+    if (__atomic_exchange_n(&worker->parked, false, __ATOMIC_SEQ_CST))
+    {
+        void (*callback)(void) = __atomic_load_n(&worker->wakeup_callback, __ATOMIC_ACQUIRE);
+        if (callback)
+        {
+            callback();
+        }
+    }
+}
+
+static inline int transport_worker_reap(transport_worker_t* worker)
+{
+    int count = io_uring_peek_batch_cqe(worker->ring, &worker->cqes[0], worker->cqe_peek_count);
+    int reaped = 0;
+    int completed = 0;
+    for (; reaped < count; reaped++)
+    {
+        struct io_uring_cqe* cqe = worker->cqes[reaped];
+        uint64_t data = cqe->user_data;
+        if (unlikely(data == TRANSPORT_EVENT_WAKEUP))
+        {
+            transport_worker_arm_io_thread_wakeup(worker);
+            continue;
+        }
+        if (unlikely(data == TRANSPORT_EVENT_LINK_TIMEOUT))
+        {
+            continue;
+        }
+        if (unlikely(transport_queue_full(&worker->completions)))
+        {
+            break;
+        }
+        struct transport_worker_completion completion = {
+            .result = cqe->res,
+            .flags = cqe->flags,
+        };
+        if (unlikely(!transport_worker_untag(worker, cqe, &completion.fd, &completion.buffer_id, &completion.event)))
+        {
+            continue;
+        }
+        if ((completion.event & TRANSPORT_EVENT_VECTOR) &&
+            transport_worker_continue_vector(worker, cqe, completion.fd, completion.buffer_id, &completion.event, &completion.result))
+        {
+            continue;
+        }
+        if ((completion.event & TRANSPORT_EVENT_SPLICE) &&
+            transport_worker_continue_splice(worker, cqe, completion.buffer_id, &completion.event, &completion.result, &completion.flags))
+        {
+            continue;
+        }
+        transport_queue_push(&worker->completions, &completion);
+        transport_worker_retire(worker, cqe);
+        if ((completion.event & TRANSPORT_EVENT_SPLICE) && (completion.flags & IORING_CQE_F_MORE))
+        {
+            transport_worker_advance_splice(worker, completion.buffer_id, completion.result);
+        }
+        completed++;
+    }
+    io_uring_cq_advance(worker->ring, reaped);
+    if (completed)
+    {
+        transport_worker_wake_parked(worker);
+    }
+    return reaped < count ? -1 : count;
+}
+
+static void* transport_worker_run_io_thread(void* argument)
+{
+    transport_worker_t* worker = (transport_worker_t*)argument;
+    struct __kernel_timespec period = {
+        .tv_sec = worker->timeout_checker_period_millis / 1000,
+        .tv_nsec = (worker->timeout_checker_period_millis % 1000) * 1000000,
+    };
+    transport_worker_arm_io_thread_wakeup(worker);
+    while (!__atomic_load_n(&worker->io_thread_stopping, __ATOMIC_ACQUIRE))
+    {
+        bool submitted = worker->backlog.count && transport_worker_flush_backlog(worker);
+        struct transport_worker_operation* operation;
+        while ((operation = transport_queue_peek(&worker->submissions)))
+        {
+            transport_worker_submit_operation(worker, operation);
+            transport_queue_pop(&worker->submissions);
+            submitted = true;
+        }
+        if (worker->timeouts.count)
+        {
+            transport_worker_check_event_timeouts(worker);
+        }
+        io_uring_submit(worker->ring);
+        int reaped = transport_worker_reap(worker);
+        if (reaped < 0)
+        {
+            sched_yield();
+            continue;
+        }
+        if (reaped || submitted)
+        {
+            continue;
+        }
+        __atomic_store_n(&worker->io_thread_sleeping, true, __ATOMIC_SEQ_CST);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if (!transport_queue_peek(&worker->submissions) && !__atomic_load_n(&worker->io_thread_stopping, __ATOMIC_ACQUIRE))
+        {
+            struct io_uring_cqe* cqe;
+            if (worker->timeouts.count || worker->backlog.count)
+            {
+                io_uring_wait_cqe_timeout(worker->ring, &cqe, &period);
+            }
+            else
+            {
+                io_uring_wait_cqe(worker->ring, &cqe);
+            }
+        }
+        __atomic_store_n(&worker->io_thread_sleeping, false, __ATOMIC_SEQ_CST);
+    }
+    return NULL;
+}
+
+static inline int transport_worker_start_io_thread(transport_worker_t* worker)
+{
+    if (transport_queue_create(&worker->submissions, worker->ring_size, sizeof(struct transport_worker_operation)) ||
+        transport_queue_create(&worker->completions, worker->ring_size, sizeof(struct transport_worker_completion)))
+    {
+        return -ENOMEM;
+    }
+    worker->io_thread_wakeup_fd = eventfd(0, EFD_CLOEXEC);
+    if (worker->io_thread_wakeup_fd < 0)
+    {
+        return -errno;
+    }
+    pthread_attr_t attributes;
+    pthread_attr_init(&attributes);
+    if (worker->io_thread_cpu >= 0)
+    {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(worker->io_thread_cpu, &cpus);
+        pthread_attr_setaffinity_np(&attributes, sizeof(cpu_set_t), &cpus);
+    }
+    int result = pthread_create(&worker->io_thread_handle, &attributes, transport_worker_run_io_thread, worker);
+    pthread_attr_destroy(&attributes);
+    if (result)
+    {
+        return -result;
+    }
+    worker->io_thread_running = true;
+    return 0;
+}
+
+static inline void transport_worker_dispatch_operation(transport_worker_t* worker, struct transport_worker_operation* operation)
+{
+    if (worker->io_thread)
+    {
+        transport_worker_push_operation(worker, operation);
+        return;
+    }
+    transport_worker_submit_operation(worker, operation);
+}
+
+static inline void transport_worker_stop_io_thread(transport_worker_t* worker)
+{
+    if (!worker->io_thread_running)
+    {
+        return;
+    }
+    __atomic_store_n(&worker->io_thread_stopping, true, __ATOMIC_RELEASE);
+    eventfd_write(worker->io_thread_wakeup_fd, 1);
+    pthread_join(worker->io_thread_handle, NULL);
+    worker->io_thread_running = false;
+}
+
+static inline int transport_worker_emit_frame(transport_worker_t* worker, uint32_t fd, uint32_t buffer_id, uint16_t event, int32_t result, uint32_t flags)
+{
+    struct transport_worker_completion completion = {
+        .fd = fd,
+        .buffer_id = buffer_id,
+        .event = event,
+        .result = result,
+        .flags = flags,
+    };
+    if (unlikely(transport_backlog_push(&worker->frames, &completion)))
+    {
+        if (flags & IORING_CQE_F_BUFFER)
+        {
+            transport_worker_release_buffer(worker, buffer_id);
+        }
+        return -ENOMEM;
+    }
+    return 0;
+}
+
+static inline int transport_worker_copy_frame(transport_worker_t* worker, struct transport_framer* framer, uint32_t fd, const uint8_t* data, uint32_t size)
+{
+    int32_t buffer_id = transport_worker_get_buffer_sized(worker, size);
+    if (unlikely(buffer_id == TRANSPORT_BUFFER_USED))
+    {
+        return -ENOBUFS;
+    }
+    memcpy(worker->buffers[buffer_id].iov_base, data, size);
+    worker->buffers[buffer_id].iov_len = size;
+    return transport_worker_emit_frame(worker, fd, buffer_id, framer->event, (int32_t)size, IORING_CQE_F_MORE | IORING_CQE_F_BUFFER);
+}
+
+static inline int transport_worker_flush_framer(transport_worker_t* worker, struct transport_framer* framer, uint32_t fd)
+{
+    struct transport_frame frame;
+    while (framer->pending_size)
+    {
+        const uint8_t* pending = framer->pending + framer->pending_start;
+        int result = transport_framer_measure(framer, pending, framer->pending_size, &frame);
+        if (result <= 0)
+        {
+            return result;
+        }
+        if ((result = transport_worker_copy_frame(worker, framer, fd, pending + frame.offset, frame.size)))
+        {
+            return result;
+        }
+        framer->pending_start += frame.consumed;
+        framer->pending_size -= frame.consumed;
+    }
+    framer->pending_start = 0;
+    return 0;
+}
+
+static inline int transport_worker_split_frames(transport_worker_t* worker, struct transport_framer* framer, uint32_t fd, uint32_t buffer_id, size_t size)
+{
+    uint8_t* data = worker->buffers[buffer_id].iov_base;
+    size_t offset = 0;
+    int result = 0;
+    if (framer->pending_size)
+    {
+        offset = transport_framer_missing(framer, data, size);
+        if ((result = transport_framer_stash(framer, data, offset)) || (result = transport_worker_flush_framer(worker, framer, fd)))
+        {
+            if (result == -ENOBUFS && transport_framer_stash(framer, data + offset, size - offset))
+            {
+                result = -ENOMEM;
+            }
+            transport_worker_release_buffer(worker, buffer_id);
+            return result;
+        }
+        if (framer->pending_size)
+        {
+            transport_worker_release_buffer(worker, buffer_id);
+            return transport_framer_stash(framer, data + offset, size - offset);
+        }
+    }
+    struct transport_frame last;
+    size_t last_offset = size;
+    struct transport_frame frame;
+    while (offset < size && (result = transport_framer_measure(framer, data + offset, size - offset, &frame)) > 0)
+    {
+        if (last_offset < size && (result = transport_worker_copy_frame(worker, framer, fd, data + last_offset + last.offset, last.size)))
+        {
+            if (transport_framer_stash(framer, data + last_offset, size - last_offset))
+            {
+                result = -ENOMEM;
+            }
+            transport_worker_release_buffer(worker, buffer_id);
+            return result;
+        }
+        last = frame;
+        last_offset = offset;
+        offset += frame.consumed;
+    }
+    if (unlikely(result < 0) || (offset < size && (result = transport_framer_stash(framer, data + offset, size - offset))))
+    {
+        transport_worker_release_buffer(worker, buffer_id);
+        return result;
+    }
+    if (last_offset == size)
+    {
+        transport_worker_release_buffer(worker, buffer_id);
+        return 0;
+    }
+    memmove(data, data + last_offset + last.offset, last.size);
+    worker->buffers[buffer_id].iov_len = last.size;
+    return transport_worker_emit_frame(worker, fd, buffer_id, framer->event, (int32_t)last.size, IORING_CQE_F_MORE | IORING_CQE_F_BUFFER);
+}
+
+static inline int transport_worker_rearm_framer(transport_worker_t* worker, struct transport_framer* framer, uint32_t fd)
+{
+    int32_t buffer_id = transport_worker_pop_default_buffer(worker);
+    if (unlikely(buffer_id == TRANSPORT_BUFFER_USED))
+    {
+        return -ENOBUFS;
+    }
+    struct transport_worker_operation operation = {
+        .code = TRANSPORT_OPERATION_READ,
+        .fd = fd,
+        .buffer_id = buffer_id,
+        .timeout = framer->timeout,
+        .event = framer->event | TRANSPORT_EVENT_FRAME,
+    };
+    transport_worker_dispatch_operation(worker, &operation);
+    return 0;
+}
+
+static inline void transport_worker_finish_framer(transport_worker_t* worker, struct transport_framer* framer, uint32_t fd, int32_t result)
+{
+    if (result == 0)
+    {
+        result = transport_worker_rearm_framer(worker, framer, fd);
+    }
+    if (result == 0)
+    {
+        return;
+    }
+    if (result != -ENOBUFS)
+    {
+        framer->pending_start = 0;
+        framer->pending_size = 0;
+    }
+    transport_worker_emit_frame(worker, fd, 0, framer->event, result, 0);
+}
+
+static inline void transport_worker_frame(transport_worker_t* worker, uint32_t fd, uint32_t buffer_id, uint16_t event, int32_t result)
+{
+    struct transport_framer* framer = transport_framers_find(&worker->framers, fd);
+    if (unlikely(framer == NULL))
+    {
+        transport_worker_release_buffer(worker, buffer_id);
+        transport_worker_emit_frame(worker, fd, 0, event & ~TRANSPORT_EVENT_FRAME, result > 0 ? -ECANCELED : result, 0);
+        return;
+    }
+    if (result <= 0)
+    {
+        transport_worker_release_buffer(worker, buffer_id);
+        framer->pending_start = 0;
+        framer->pending_size = 0;
+        transport_worker_emit_frame(worker, fd, 0, framer->event, result, 0);
+        return;
+    }
+    transport_worker_finish_framer(worker, framer, fd, transport_worker_split_frames(worker, framer, fd, buffer_id, result));
+}
+
+static inline void transport_worker_fail_operation(transport_worker_t* worker, uint32_t fd, uint32_t buffer_id, uint16_t event, int32_t result)
+{
+    struct transport_worker_completion completion = {
+        .fd = fd,
+        .buffer_id = buffer_id,
+        .event = event,
+        .result = result,
+    };
+    if (worker->io_thread)
+    {
+        while (unlikely(!transport_queue_push(&worker->completions, &completion)))
+        {
+            sched_yield();
+        }
+        transport_worker_wake_parked(worker);
+        return;
+    }
+    if (event & TRANSPORT_EVENT_FRAME)
+    {
+        transport_worker_frame(worker, fd, buffer_id, event, result);
+        return;
+    }
+    if (event & TRANSPORT_EVENT_SPLICE)
+    {
+        transport_worker_finish_splice(worker, buffer_id);
+    }
+    transport_worker_emit_frame(worker, fd, buffer_id, event, result, 0);
+}
+
+static inline uint32_t transport_worker_drain_frames(transport_worker_t* worker, uint32_t drained)
+{
+    struct transport_worker_completion* completion;
+    while (drained < worker->cqe_peek_count && (completion = transport_backlog_peek(&worker->frames)))
+    {
+        worker->completion_fds[drained] = completion->fd;
+        worker->completion_buffer_ids[drained] = completion->buffer_id;
+        worker->completion_events[drained] = completion->event;
+        worker->completion_results[drained] = completion->result;
+        worker->completion_flags[drained] = completion->flags;
+        transport_backlog_pop(&worker->frames);
+        drained++;
+    }
+    return drained;
+}
+
+static inline void transport_worker_rearm_stream(transport_worker_t* worker, uint32_t fd, uint16_t event, int32_t result, uint32_t* flags)
+{
+    if (result <= 0 || (event & ~(TRANSPORT_EVENT_SERVER | TRANSPORT_EVENT_CLIENT)) != TRANSPORT_EVENT_READ)
+    {
+        return;
+    }
+    struct transport_stream* stream = transport_streams_find(&worker->streams, fd);
+    if (stream == NULL || stream->event != event)
+    {
+        return;
+    }
+    int32_t buffer_id = transport_worker_pop_default_buffer(worker);
+    if (unlikely(buffer_id == TRANSPORT_BUFFER_USED))
+    {
+        return;
+    }
+    struct transport_worker_operation operation = {
+        .code = TRANSPORT_OPERATION_READ,
+        .fd = fd,
+        .buffer_id = buffer_id,
+        .timeout = stream->timeout,
+        .event = event,
+    };
+    transport_worker_dispatch_operation(worker, &operation);
+    *flags |= IORING_CQE_F_MORE;
 }
 
-int32_t transport_worker_used_buffers(transport_worker_t* worker)
+int32_t transport_worker_read_framed(transport_worker_t* worker,
+                                     uint32_t fd,
+                                     uint8_t mode,
+                                     uint8_t length_size,
+                                     uint8_t delimiter,
+                                     uint32_t max_frame_size,
+                                     int64_t timeout,
+                                     uint16_t event)
 {
-    return worker->buffers_count - worker->free_buffers.count;
+    if ((mode != TRANSPORT_FRAMING_LENGTH && mode != TRANSPORT_FRAMING_DELIMITER) ||
+        (mode == TRANSPORT_FRAMING_LENGTH && (length_size == 0 || length_size > sizeof(uint32_t))))
+    {
+        return -EINVAL;
+    }
+    if (max_frame_size == 0 || max_frame_size > worker->buffer_classes[transport_worker_select_buffer_class(worker, UINT32_MAX)].size)
+    {
+        return -EMSGSIZE;
+    }
+    struct transport_framer* framer = transport_framers_reserve(&worker->framers, fd);
+    if (unlikely(framer == NULL))
+    {
+        return -ENOMEM;
+    }
+    framer->mode = mode;
+    framer->length_size = length_size;
+    framer->delimiter = delimiter;
+    framer->max_frame_size = max_frame_size;
+    framer->timeout = timeout;
+    framer->event = event;
+    uint32_t emitted = worker->frames.count;
+    transport_worker_finish_framer(worker, framer, fd, transport_worker_flush_framer(worker, framer, fd));
+    if (worker->frames.count != emitted)
+    {
+        transport_worker_wake_parked(worker);
+    }
+    return 0;
 }
 
-void transport_worker_release_buffer(transport_worker_t* worker, uint16_t buffer_id)
+void transport_worker_clear_framing(transport_worker_t* worker, uint32_t fd)
 {
-    struct iovec* buffer = &worker->buffers[buffer_id];
-    memset(buffer->iov_base, 0, worker->buffer_size);
-    buffer->iov_len = worker->buffer_size;
-    transport_buffers_pool_push(&worker->free_buffers, buffer_id);
+    struct transport_framer* framer = transport_framers_find(&worker->framers, fd);
+    if (framer)
+    {
+        transport_framer_reset(framer);
+    }
 }
 
-static inline void transport_worker_add_event(transport_worker_t* worker, int fd, uint64_t data, int64_t timeout)
+int32_t transport_worker_read_stream(transport_worker_t* worker,
+                                     uint32_t fd,
+                                     uint32_t buffer_id,
+                                     int64_t timeout,
+                                     uint16_t event)
 {
-    struct mh_events_node_t node = {
-        .data = data,
-        .timeout = timeout,
-        .timestamp = time(NULL),
+    struct transport_stream* stream = transport_streams_reserve(&worker->streams, fd);
+    if (unlikely(stream == NULL))
+    {
+        return -ENOMEM;
+    }
+    stream->armed = true;
+    stream->event = event;
+    stream->timeout = timeout;
+    struct transport_worker_operation operation = {
+        .code = TRANSPORT_OPERATION_READ,
         .fd = fd,
+        .buffer_id = buffer_id,
+        .timeout = timeout,
+        .event = event,
     };
-    mh_events_put(worker->events, &node, NULL, 0);
+    transport_worker_dispatch_operation(worker, &operation);
+    return 0;
+}
+
+void transport_worker_clear_stream(transport_worker_t* worker, uint32_t fd)
+{
+    struct transport_stream* stream = transport_streams_find(&worker->streams, fd);
+    if (stream)
+    {
+        stream->armed = false;
+    }
 }
 
 void transport_worker_write(transport_worker_t* worker,
                             uint32_t fd,
-                            uint16_t buffer_id,
+                            uint32_t buffer_id,
                             uint32_t offset,
                             int64_t timeout,
                             uint16_t event,
                             uint8_t sqe_flags)
 {
-    struct io_uring* ring = worker->ring;
-    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
-    uint64_t data = (((uint64_t)(fd) << 32) | (uint64_t)(buffer_id) << 16) | ((uint64_t)event);
-    struct iovec* buffer = &worker->buffers[buffer_id];
-    io_uring_prep_write_fixed(sqe, fd, buffer->iov_base, buffer->iov_len, offset, buffer_id);
-    io_uring_sqe_set_data64(sqe, data);
-    sqe->flags |= sqe_flags;
-    transport_worker_add_event(worker, fd, data, timeout);
+    struct transport_worker_operation operation = {
+        .code = TRANSPORT_OPERATION_WRITE,
+        .fd = fd,
+        .buffer_id = buffer_id,
+        .offset = offset,
+        .timeout = timeout,
+        .event = event,
+        .sqe_flags = sqe_flags,
+    };
+    transport_worker_dispatch_operation(worker, &operation);
+}
+
+int32_t transport_worker_write_vector(transport_worker_t* worker,
+                                      uint32_t fd,
+                                      uint32_t count,
+                                      uint32_t offset,
+                                      int64_t timeout,
+                                      uint16_t event,
+                                      uint8_t sqe_flags)
+{
+    if (unlikely(!transport_vectors_prepare(&worker->vectors, worker->buffers, worker->vector_buffer_ids, count, offset, timeout)))
+    {
+        return -ENOMEM;
+    }
+    struct transport_worker_operation operation = {
+        .code = TRANSPORT_OPERATION_WRITE_VECTOR,
+        .fd = fd,
+        .buffer_id = worker->vector_buffer_ids[0],
+        .event = event,
+        .sqe_flags = sqe_flags,
+    };
+    transport_worker_dispatch_operation(worker, &operation);
+    return 0;
 }
 
 void transport_worker_read(transport_worker_t* worker,
                            uint32_t fd,
-                           uint16_t buffer_id,
+                           uint32_t buffer_id,
                            uint32_t offset,
                            int64_t timeout,
                            uint16_t event,
                            uint8_t sqe_flags)
 {
-    struct io_uring* ring = worker->ring;
-    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
-    uint64_t data = (((uint64_t)(fd) << 32) | (uint64_t)(buffer_id) << 16) | ((uint64_t)event);
-    struct iovec* buffer = &worker->buffers[buffer_id];
-    io_uring_prep_read_fixed(sqe, fd, buffer->iov_base, buffer->iov_len, offset, buffer_id);
-    io_uring_sqe_set_data64(sqe, data);
-    sqe->flags |= sqe_flags;
-    transport_worker_add_event(worker, fd, data, timeout);
+    struct transport_worker_operation operation = {
+        .code = TRANSPORT_OPERATION_READ,
+        .fd = fd,
+        .buffer_id = buffer_id,
+        .offset = offset,
+        .timeout = timeout,
+        .event = event,
+        .sqe_flags = sqe_flags,
+    };
+    transport_worker_dispatch_operation(worker, &operation);
+}
+
+void transport_worker_send_zero_copy(transport_worker_t* worker,
+                                     uint32_t fd,
+                                     uint32_t buffer_id,
+                                     int64_t timeout,
+                                     uint16_t event,
+                                     uint8_t sqe_flags)
+{
+    struct transport_worker_operation operation = {
+        .code = TRANSPORT_OPERATION_SEND_ZERO_COPY,
+        .fd = fd,
+        .buffer_id = buffer_id,
+        .timeout = timeout,
+        .event = event,
+        .sqe_flags = sqe_flags,
+    };
+    transport_worker_dispatch_operation(worker, &operation);
 }
 
 void transport_worker_send_message(transport_worker_t* worker,
                                    uint32_t fd,
-                                   uint16_t buffer_id,
+                                   uint32_t buffer_id,
                                    struct sockaddr* address,
                                    transport_socket_family_t socket_family,
                                    int message_flags,
@@ -174,165 +2241,482 @@ void transport_worker_send_message(transport_worker_t* worker,
                                    uint16_t event,
                                    uint8_t sqe_flags)
 {
-    struct io_uring* ring = worker->ring;
-    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
-    uint64_t data = (((uint64_t)(fd) << 32) | (uint64_t)(buffer_id) << 16) | ((uint64_t)event);
-    struct msghdr* message;
-    if (socket_family == INET)
-    {
-        message = &worker->inet_used_messages[buffer_id];
-        memcpy(message->msg_name, address, message->msg_namelen);
-    }
-    if (socket_family == UNIX)
-    {
-        message = &worker->unix_used_messages[buffer_id];
-        message->msg_namelen = SUN_LEN((struct sockaddr_un*)address);
-        memcpy(message->msg_name, address, message->msg_namelen);
-    }
-    message->msg_control = NULL;
-    message->msg_controllen = 0;
-    message->msg_iov = &worker->buffers[buffer_id];
-    message->msg_iovlen = 1;
-    message->msg_flags = 0;
-    io_uring_prep_sendmsg(sqe, fd, message, message_flags);
-    io_uring_sqe_set_data64(sqe, data);
-    sqe->flags |= sqe_flags;
-    transport_worker_add_event(worker, fd, data, timeout);
+    struct transport_worker_operation operation = {
+        .code = TRANSPORT_OPERATION_SEND_MESSAGE,
+        .fd = fd,
+        .buffer_id = buffer_id,
+        .pointer = address,
+        .socket_family = socket_family,
+        .message_flags = message_flags,
+        .timeout = timeout,
+        .event = event,
+        .sqe_flags = sqe_flags,
+    };
+    transport_worker_dispatch_operation(worker, &operation);
+}
+
+void transport_worker_send_message_zero_copy(transport_worker_t* worker,
+                                             uint32_t fd,
+                                             uint32_t buffer_id,
+                                             struct sockaddr* address,
+                                             transport_socket_family_t socket_family,
+                                             int message_flags,
+                                             int64_t timeout,
+                                             uint16_t event,
+                                             uint8_t sqe_flags)
+{
+    struct transport_worker_operation operation = {
+        .code = TRANSPORT_OPERATION_SEND_MESSAGE_ZERO_COPY,
+        .fd = fd,
+        .buffer_id = buffer_id,
+        .pointer = address,
+        .socket_family = socket_family,
+        .message_flags = message_flags,
+        .timeout = timeout,
+        .event = event,
+        .sqe_flags = sqe_flags,
+    };
+    transport_worker_dispatch_operation(worker, &operation);
 }
 
 void transport_worker_receive_message(transport_worker_t* worker,
                                       uint32_t fd,
-                                      uint16_t buffer_id,
+                                      uint32_t buffer_id,
                                       transport_socket_family_t socket_family,
                                       int message_flags,
                                       int64_t timeout,
                                       uint16_t event,
                                       uint8_t sqe_flags)
 {
-    struct io_uring* ring = worker->ring;
-    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
-    uint64_t data = (((uint64_t)(fd) << 32) | (uint64_t)(buffer_id) << 16) | ((uint64_t)event);
-    struct msghdr* message;
-    if (socket_family == INET)
+    struct transport_worker_operation operation = {
+        .code = TRANSPORT_OPERATION_RECEIVE_MESSAGE,
+        .fd = fd,
+        .buffer_id = buffer_id,
+        .socket_family = socket_family,
+        .message_flags = message_flags,
+        .timeout = timeout,
+        .event = event,
+        .sqe_flags = sqe_flags,
+    };
+    transport_worker_dispatch_operation(worker, &operation);
+}
+
+void transport_worker_read_multishot(transport_worker_t* worker,
+                                     uint32_t fd,
+                                     int64_t timeout,
+                                     uint16_t event,
+                                     uint8_t sqe_flags)
+{
+    struct transport_worker_operation operation = {
+        .code = TRANSPORT_OPERATION_READ_MULTISHOT,
+        .fd = fd,
+        .timeout = timeout,
+        .event = event,
+        .sqe_flags = sqe_flags,
+    };
+    transport_worker_dispatch_operation(worker, &operation);
+}
+
+void transport_worker_connect(transport_worker_t* worker, transport_client_t* client, int64_t timeout)
+{
+    struct transport_worker_operation operation = {
+        .code = TRANSPORT_OPERATION_CONNECT,
+        .pointer = client,
+        .timeout = timeout,
+    };
+    transport_worker_dispatch_operation(worker, &operation);
+}
+
+void transport_worker_accept(transport_worker_t* worker, transport_server_t* server)
+{
+    struct transport_worker_operation operation = {
+        .code = TRANSPORT_OPERATION_ACCEPT,
+        .pointer = server,
+    };
+    transport_worker_dispatch_operation(worker, &operation);
+}
+
+void transport_worker_accept_multishot(transport_worker_t* worker, transport_server_t* server)
+{
+    struct transport_worker_operation operation = {
+        .code = TRANSPORT_OPERATION_ACCEPT_MULTISHOT,
+        .pointer = server,
+    };
+    transport_worker_dispatch_operation(worker, &operation);
+}
+
+int32_t transport_worker_send_file(transport_worker_t* worker,
+                                   uint32_t fd,
+                                   uint32_t source_fd,
+                                   uint64_t offset,
+                                   uint64_t length,
+                                   uint32_t chunk_size,
+                                   int64_t timeout,
+                                   uint16_t event)
+{
+    if (length == 0 || chunk_size == 0)
     {
-        message = &worker->inet_used_messages[buffer_id];
-        message->msg_namelen = sizeof(struct sockaddr_in);
+        return -EINVAL;
     }
-    if (socket_family == UNIX)
+    int32_t id = transport_splices_acquire(&worker->splices, chunk_size);
+    if (id < 0)
     {
-        message = &worker->unix_used_messages[buffer_id];
-        message->msg_namelen = sizeof(struct sockaddr_un);
+        return id;
     }
-    message->msg_control = NULL;
-    message->msg_controllen = 0;
-    memset(message->msg_name, 0, message->msg_namelen);
-    message->msg_iov = &worker->buffers[buffer_id];
-    message->msg_iovlen = 1;
-    message->msg_flags = 0;
-    io_uring_prep_recvmsg(sqe, fd, message, message_flags);
-    io_uring_sqe_set_data64(sqe, data);
-    sqe->flags |= sqe_flags;
-    transport_worker_add_event(worker, fd, data, timeout);
+    struct transport_splice* splice = &worker->splices.entries[id];
+    splice->fd = fd;
+    splice->source_fd = source_fd;
+    splice->offset = offset;
+    splice->remaining = length;
+    splice->chunk_size = chunk_size < splice->pipe_size ? chunk_size : splice->pipe_size;
+    splice->timeout = timeout;
+    splice->event = event | TRANSPORT_EVENT_SPLICE;
+    struct transport_worker_operation operation = {
+        .code = TRANSPORT_OPERATION_SPLICE,
+        .buffer_id = (uint32_t)id,
+    };
+    transport_worker_dispatch_operation(worker, &operation);
+    return id;
 }
 
-void transport_worker_connect(transport_worker_t* worker, transport_client_t* client, int64_t timeout)
+static inline void transport_worker_prepare_proxy(transport_worker_t* worker, uint32_t id, uint32_t source_fd, uint32_t fd, uint32_t peer, uint32_t chunk_size)
 {
-    struct io_uring* ring = worker->ring;
-    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
-    uint64_t data = ((uint64_t)(client->fd) << 32) | ((uint64_t)TRANSPORT_EVENT_CONNECT | (uint64_t)TRANSPORT_EVENT_CLIENT);
-    struct sockaddr* address = client->family == INET
-                                   ? (struct sockaddr*)&client->inet_destination_address
-                                   : (struct sockaddr*)&client->unix_destination_address;
-    io_uring_prep_connect(sqe, client->fd, address, client->client_address_length);
-    io_uring_sqe_set_data64(sqe, data);
-    transport_worker_add_event(worker, client->fd, data, timeout);
+    struct transport_splice* splice = &worker->splices.entries[id];
+    splice->fd = fd;
+    splice->source_fd = source_fd;
+    splice->chunk_size = chunk_size < splice->pipe_size ? chunk_size : splice->pipe_size;
+    splice->timeout = TRANSPORT_TIMEOUT_INFINITY;
+    splice->event = TRANSPORT_EVENT_SPLICE;
+    splice->peer = peer;
+    splice->proxy = true;
 }
 
-void transport_worker_accept(transport_worker_t* worker, transport_server_t* server)
+int32_t transport_worker_proxy(transport_worker_t* worker, uint32_t fd, uint32_t peer_fd, uint32_t chunk_size)
 {
-    struct io_uring* ring = worker->ring;
-    struct io_uring_sqe* sqe = transport_provide_sqe(ring);
-    uint64_t data = ((uint64_t)(server->fd) << 32) | ((uint64_t)TRANSPORT_EVENT_ACCEPT | (uint64_t)TRANSPORT_EVENT_SERVER);
-    struct sockaddr* address = server->family == INET
-                                   ? (struct sockaddr*)&server->inet_server_address
-                                   : (struct sockaddr*)&server->unix_server_address;
-    io_uring_prep_accept(sqe, server->fd, address, &server->server_address_length, 0);
-    io_uring_sqe_set_data64(sqe, data);
-    transport_worker_add_event(worker, server->fd, data, TRANSPORT_TIMEOUT_INFINITY);
+    if (chunk_size == 0 || fd == peer_fd)
+    {
+        return -EINVAL;
+    }
+    int32_t forward = transport_splices_acquire(&worker->splices, chunk_size);
+    if (forward < 0)
+    {
+        return forward;
+    }
+    int32_t backward = transport_splices_acquire(&worker->splices, chunk_size);
+    if (backward < 0)
+    {
+        transport_splices_release(&worker->splices, forward);
+        return backward;
+    }
+    transport_worker_prepare_proxy(worker, forward, fd, peer_fd, backward, chunk_size);
+    transport_worker_prepare_proxy(worker, backward, peer_fd, fd, forward, chunk_size);
+    struct transport_worker_operation operation = {
+        .code = TRANSPORT_OPERATION_SPLICE,
+        .buffer_id = (uint32_t)forward,
+    };
+    transport_worker_dispatch_operation(worker, &operation);
+    operation.buffer_id = (uint32_t)backward;
+    transport_worker_dispatch_operation(worker, &operation);
+    return forward;
+}
+
+void transport_worker_close_proxy(transport_worker_t* worker, uint32_t id)
+{
+    struct transport_splice* splice = &worker->splices.entries[id];
+    bool closing = __atomic_exchange_n(&splice->closing, true, __ATOMIC_ACQ_REL);
+    bool peer_closing = __atomic_exchange_n(&worker->splices.entries[splice->peer].closing, true, __ATOMIC_ACQ_REL);
+    if (closing && peer_closing)
+    {
+        return;
+    }
+    struct transport_worker_operation operation = {
+        .code = TRANSPORT_OPERATION_CANCEL_PROXY,
+        .buffer_id = id,
+    };
+    transport_worker_dispatch_operation(worker, &operation);
+}
+
+void transport_worker_release_proxy(transport_worker_t* worker, uint32_t id)
+{
+    uint32_t peer = worker->splices.entries[id].peer;
+    transport_splices_release(&worker->splices, id);
+    transport_splices_release(&worker->splices, peer);
 }
 
 void transport_worker_cancel_by_fd(transport_worker_t* worker, int fd)
 {
-    mh_int_t index;
-    mh_int_t to_delete[worker->events->size];
-    int to_delete_count = 0;
-    mh_foreach(worker->events, index)
+    struct transport_worker_operation operation = {
+        .code = TRANSPORT_OPERATION_CANCEL_BY_FD,
+        .fd = fd,
+    };
+    transport_worker_dispatch_operation(worker, &operation);
+}
+
+bool transport_worker_park(transport_worker_t* worker)
+{
+    transport_worker_arm_timeouts(worker);
+    if (!worker->io_thread && io_uring_sq_ready(worker->ring))
     {
-        struct mh_events_node_t* node = mh_events_node(worker->events, index);
-        if (node->fd == fd)
-        {
-            struct io_uring* ring = worker->ring;
-            struct io_uring_sqe* sqe = transport_provide_sqe(ring);
-            io_uring_prep_cancel(sqe, (void*)node->data, IORING_ASYNC_CANCEL_ALL);
-            sqe->flags |= IOSQE_CQE_SKIP_SUCCESS;
-            to_delete[to_delete_count++] = index;
-        }
+        io_uring_submit(worker->ring);
     }
-    for (int index = 0; index < to_delete_count; index++)
+    __atomic_store_n(&worker->parked, true, __ATOMIC_SEQ_CST);
+    if (worker->frames.count || (worker->io_thread && transport_queue_peek(&worker->completions)))
     {
-        mh_events_del(worker->events, to_delete[index], 0);
+        return !__atomic_exchange_n(&worker->parked, false, __ATOMIC_SEQ_CST);
     }
-    io_uring_submit(worker->ring);
+    return true;
 }
 
 int transport_worker_peek(transport_worker_t* worker)
 {
+    if (worker->link_timeouts && worker->timeouts.count)
+    {
+        transport_worker_check_event_timeouts(worker);
+        transport_worker_arm_timeouts(worker);
+    }
+    if (unlikely(worker->backlog.count))
+    {
+        transport_worker_flush_backlog(worker);
+    }
     struct __kernel_timespec timeout = {
         .tv_nsec = worker->cqe_wait_timeout_millis * 1e+6,
         .tv_sec = 0,
     };
+    if (worker->eventfd_wakeups)
+    {
+        io_uring_submit(worker->ring);
+        return io_uring_peek_batch_cqe(worker->ring, &worker->cqes[0], worker->cqe_peek_count);
+    }
     io_uring_submit_and_wait_timeout(worker->ring, &worker->cqes[0], worker->cqe_wait_count, &timeout, 0);
     return io_uring_peek_batch_cqe(worker->ring, &worker->cqes[0], worker->cqe_peek_count);
 }
 
-void transport_worker_check_event_timeouts(transport_worker_t* worker)
+int transport_worker_drain(transport_worker_t* worker)
 {
-    mh_int_t index;
-    mh_int_t to_delete[worker->events->size];
-    int to_delete_count = 0;
-    mh_foreach(worker->events, index)
+    uint32_t drained = transport_worker_drain_frames(worker, 0);
+    if (worker->io_thread)
+    {
+        struct transport_worker_completion* completion;
+        while (drained < worker->cqe_peek_count && (completion = transport_queue_peek(&worker->completions)))
+        {
+            if (unlikely(completion->event & TRANSPORT_EVENT_FRAME))
+            {
+                transport_worker_frame(worker, completion->fd, completion->buffer_id, completion->event, completion->result);
+                transport_queue_pop(&worker->completions);
+                drained = transport_worker_drain_frames(worker, drained);
+                continue;
+            }
+            worker->completion_fds[drained] = completion->fd;
+            worker->completion_buffer_ids[drained] = completion->buffer_id;
+            worker->completion_events[drained] = completion->event;
+            worker->completion_results[drained] = completion->result;
+            worker->completion_flags[drained] = completion->flags;
+            if (unlikely(completion->event & TRANSPORT_EVENT_SPLICE) && !(completion->flags & IORING_CQE_F_MORE))
+            {
+                transport_worker_finish_splice(worker, completion->buffer_id);
+            }
+            transport_worker_rearm_stream(worker, completion->fd, completion->event, completion->result, &worker->completion_flags[drained]);
+            transport_queue_pop(&worker->completions);
+            drained++;
+        }
+        return (int)drained;
+    }
+    if (drained == worker->cqe_peek_count)
+    {
+        return (int)drained;
+    }
+    uint32_t count = (uint32_t)transport_worker_peek(worker);
+    uint32_t index = 0;
+    bool ticked = false;
+    for (; index < count && drained < worker->cqe_peek_count; index++)
     {
-        struct mh_events_node_t* node = mh_events_node(worker->events, index);
-        int64_t timeout = node->timeout;
-        if (timeout == TRANSPORT_TIMEOUT_INFINITY)
+        struct io_uring_cqe* cqe = worker->cqes[index];
+        uint64_t data = cqe->user_data;
+        if (unlikely(data == TRANSPORT_EVENT_LINK_TIMEOUT))
+        {
+            continue;
+        }
+        if (unlikely(data == TRANSPORT_EVENT_TIMEOUTS_TICK))
+        {
+            worker->timeouts_armed = false;
+            ticked = true;
+            continue;
+        }
+        if (unlikely(!transport_worker_untag(worker, cqe, &worker->completion_fds[drained], &worker->completion_buffer_ids[drained], &worker->completion_events[drained])))
+        {
+            continue;
+        }
+        if (unlikely(worker->completion_events[drained] & TRANSPORT_EVENT_FRAME))
+        {
+            transport_worker_retire(worker, cqe);
+            transport_worker_frame(worker, worker->completion_fds[drained], worker->completion_buffer_ids[drained], worker->completion_events[drained], cqe->res);
+            drained = transport_worker_drain_frames(worker, drained);
+            continue;
+        }
+        worker->completion_results[drained] = cqe->res;
+        if ((worker->completion_events[drained] & TRANSPORT_EVENT_VECTOR) &&
+            transport_worker_continue_vector(worker,
+                                             cqe,
+                                             worker->completion_fds[drained],
+                                             worker->completion_buffer_ids[drained],
+                                             &worker->completion_events[drained],
+                                             &worker->completion_results[drained]))
         {
             continue;
         }
-        uint64_t timestamp = node->timestamp;
-        uint64_t data = node->data;
-        time_t current_time = time(NULL);
-        if (current_time - timestamp > timeout)
+        worker->completion_flags[drained] = cqe->flags;
+        if (unlikely(worker->completion_events[drained] & TRANSPORT_EVENT_SPLICE))
         {
-            struct io_uring* ring = worker->ring;
-            struct io_uring_sqe* sqe = transport_provide_sqe(ring);
-            io_uring_prep_cancel(sqe, (void*)data, IORING_ASYNC_CANCEL_ALL);
-            sqe->flags |= IOSQE_CQE_SKIP_SUCCESS;
-            to_delete[to_delete_count++] = index;
+            if (transport_worker_continue_splice(worker,
+                                                 cqe,
+                                                 worker->completion_buffer_ids[drained],
+                                                 &worker->completion_events[drained],
+                                                 &worker->completion_results[drained],
+                                                 &worker->completion_flags[drained]))
+            {
+                continue;
+            }
+            transport_worker_retire(worker, cqe);
+            if (worker->completion_flags[drained] & IORING_CQE_F_MORE)
+            {
+                transport_worker_advance_splice(worker, worker->completion_buffer_ids[drained], worker->completion_results[drained]);
+            }
+            else
+            {
+                transport_worker_finish_splice(worker, worker->completion_buffer_ids[drained]);
+            }
+            drained++;
+            continue;
         }
+        transport_worker_retire(worker, cqe);
+        transport_worker_rearm_stream(worker,
+                                      worker->completion_fds[drained],
+                                      worker->completion_events[drained],
+                                      worker->completion_results[drained],
+                                      &worker->completion_flags[drained]);
+        drained++;
     }
-    for (int index = 0; index < to_delete_count; index++)
+    io_uring_cq_advance(worker->ring, index);
+    if (unlikely(ticked))
     {
-        mh_events_del(worker->events, to_delete[index], 0);
+        transport_worker_check_event_timeouts(worker);
+        transport_worker_arm_timeouts(worker);
+        io_uring_submit(worker->ring);
+    }
+    return (int)drained;
+}
+
+static void* transport_worker_watch_wakeups(void* argument)
+{
+    transport_worker_t* worker = (transport_worker_t*)argument;
+    eventfd_t value;
+    for (;;)
+    {
+        if (eventfd_read(worker->wakeup_fd, &value) && errno != EINTR)
+        {
+            break;
+        }
+        if (__atomic_load_n(&worker->wakeup_stopping, __ATOMIC_ACQUIRE))
+        {
+            break;
+        }
+        worker->wakeup_callback();
+    }
+    return NULL;
+}
+
+int transport_worker_start_wakeups(transport_worker_t* worker, void (*callback)(void))
+{
+    if (worker->io_thread)
+    {
+        __atomic_store_n(&worker->wakeup_callback, callback, __ATOMIC_RELEASE);
+        return 0;
+    }
+    worker->wakeup_fd = eventfd(0, EFD_CLOEXEC);
+    if (worker->wakeup_fd < 0)
+    {
+        return -errno;
+    }
+    int result = io_uring_register_eventfd(worker->ring, worker->wakeup_fd);
+    if (result)
+    {
+        close(worker->wakeup_fd);
+        worker->wakeup_fd = -1;
+        return result;
+    }
+    worker->wakeup_callback = callback;
+    worker->wakeup_stopping = false;
+    result = pthread_create(&worker->wakeup_watcher, NULL, transport_worker_watch_wakeups, worker);
+    if (result)
+    {
+        io_uring_unregister_eventfd(worker->ring);
+        close(worker->wakeup_fd);
+        worker->wakeup_fd = -1;
+        return -result;
+    }
+    return 0;
+}
+
+void transport_worker_stop_wakeups(transport_worker_t* worker)
+{
+    if (worker->io_thread)
+    {
+        transport_worker_stop_io_thread(worker);
+        return;
+    }
+    if (worker->wakeup_fd < 0)
+    {
+        return;
+    }
+    __atomic_store_n(&worker->wakeup_stopping, true, __ATOMIC_RELEASE);
+    eventfd_write(worker->wakeup_fd, 1);
+    pthread_join(worker->wakeup_watcher, NULL);
+    io_uring_unregister_eventfd(worker->ring);
+    close(worker->wakeup_fd);
+    worker->wakeup_fd = -1;
+}
+
+void transport_worker_check_event_timeouts(transport_worker_t* worker)
+{
+    transport_timeouts_advance(&worker->timeouts, transport_timeouts_now());
+    uint64_t data;
+    bool expired = false;
+    while (transport_timeouts_pop_expired(&worker->timeouts, &data))
+    {
+        struct transport_event* event;
+        if ((event = transport_worker_find_event(worker, data)))
+        {
+            event->timeout = TRANSPORT_TIMEOUTS_NONE;
+            transport_worker_delete_event(worker, event);
+        }
+        struct transport_worker_operation operation = {
+            .code = TRANSPORT_OPERATION_CANCEL_EVENT,
+            .data = data,
+        };
+        transport_worker_submit_operation(worker, &operation);
+        expired = true;
+    }
+    if (expired)
+    {
+        io_uring_submit(worker->ring);
     }
-    io_uring_submit(worker->ring);
 }
 
 void transport_worker_remove_event(transport_worker_t* worker, uint64_t data)
 {
-    mh_int_t event;
-    if ((event = mh_events_find(worker->events, data, 0)) != mh_end(worker->events))
+    struct transport_event* event;
+    if ((event = transport_worker_find_event(worker, data)))
+    {
+        transport_worker_delete_event(worker, event);
+    }
+}
+
+void transport_worker_touch_event(transport_worker_t* worker, uint64_t data)
+{
+    struct transport_event* event;
+    if ((event = transport_worker_find_event(worker, data)) && event->timeout != TRANSPORT_TIMEOUTS_NONE)
     {
-        mh_events_del(worker->events, event, 0);
+        transport_timeouts_restart(&worker->timeouts, event->timeout, transport_timeouts_now());
     }
 }
 
@@ -344,19 +2728,58 @@ struct sockaddr* transport_worker_get_datagram_address(transport_worker_t* worke
 
 void transport_worker_destroy(transport_worker_t* worker)
 {
+    transport_worker_stop_wakeups(worker);
+    transport_worker_stop_io_thread(worker);
     io_uring_queue_exit(worker->ring);
-    for (size_t index = 0; index < worker->buffers_count; index++)
+    if (worker->io_thread_wakeup_fd >= 0)
     {
-        free(worker->buffers[index].iov_base);
-        free(worker->inet_used_messages[index].msg_name);
-        free(worker->unix_used_messages[index].msg_name);
+        close(worker->io_thread_wakeup_fd);
+    }
+    transport_queue_destroy(&worker->submissions);
+    transport_queue_destroy(&worker->completions);
+    transport_backlog_destroy(&worker->backlog);
+    if (worker->buffers_arena)
+    {
+        munmap(worker->buffers_arena, worker->buffers_arena_size);
+    }
+    for (uint32_t index = 0; index < worker->buffers_chunks_count; index++)
+    {
+        munmap(worker->buffers_chunks[index].memory, worker->buffers_chunks[index].size);
+    }
+    free(worker->buffers_chunks);
+    free(worker->provided_buffers);
+    free(worker->registered_files);
+    free(worker->link_timeout_specs);
+    if (worker->buffer_classes)
+    {
+        for (uint8_t index = 0; index < worker->buffer_classes_count; index++)
+        {
+            transport_buffers_pool_destroy(&worker->buffer_classes[index].free_buffers);
+        }
+        free(worker->buffer_classes);
     }
-    transport_buffers_pool_destroy(&worker->free_buffers);
-    mh_events_delete(worker->events);
+    transport_events_destroy(&worker->events);
+    transport_tags_destroy(&worker->tags);
+    transport_vectors_destroy(&worker->vectors);
+    transport_framers_destroy(&worker->framers);
+    transport_streams_destroy(&worker->streams);
+    transport_backlog_destroy(&worker->frames);
+    transport_splices_destroy(&worker->splices);
+    free(worker->vector_buffer_ids);
+    free(worker->buffer_references);
+    transport_timeouts_destroy(&worker->timeouts);
+    transport_fd_events_destroy(&worker->fd_events);
     free(worker->cqes);
+    free(worker->completion_fds);
+    free(worker->completion_buffer_ids);
+    free(worker->completion_events);
+    free(worker->completion_results);
+    free(worker->completion_flags);
     free(worker->buffers);
     free(worker->inet_used_messages);
     free(worker->unix_used_messages);
+    free(worker->inet_used_addresses);
+    free(worker->unix_used_addresses);
     free(worker->ring);
     free(worker);
 }
\ No newline at end of file
@@ -1,12 +1,22 @@
 #ifndef TRANSPORT_WORKER_H
 #define TRANSPORT_WORKER_H
 
+#include <pthread.h>
 #include <stdint.h>
 #include <stdio.h>
+#include "transport_backlog.h"
 #include "transport_buffers_pool.h"
 #include "transport_client.h"
-#include "transport_collections.h"
+#include "transport_events.h"
+#include "transport_fd_events.h"
+#include "transport_framing.h"
+#include "transport_queue.h"
 #include "transport_server.h"
+#include "transport_splices.h"
+#include "transport_streams.h"
+#include "transport_tags.h"
+#include "transport_timeouts.h"
+#include "transport_vectors.h"
 
 #if defined(__cplusplus)
 extern "C"
@@ -14,10 +24,26 @@ extern "C"
 #endif
     typedef struct transport_worker_configuration
     {
-        uint16_t buffers_count;
+        uint32_t buffers_count;
+        uint16_t provided_buffers_count;
         uint32_t buffer_size;
+        uint32_t buffer_class_sizes[TRANSPORT_BUFFER_CLASSES_MAX];
+        uint32_t buffer_class_counts[TRANSPORT_BUFFER_CLASSES_MAX];
+        uint8_t buffer_classes_count;
+        uint32_t max_buffers_count;
+        uint32_t buffers_grow_chunk;
+        uint64_t buffers_shrink_idle_millis;
+        bool huge_pages;
+        bool zero_buffers;
+        uint32_t registered_files_count;
+        uint32_t splice_pipes_count;
+        bool link_timeouts;
+        bool eventfd_wakeups;
+        bool io_thread;
+        int32_t io_thread_cpu;
         size_t ring_size;
         unsigned int ring_flags;
+        double submit_fill_factor;
         uint64_t timeout_checker_period_millis;
         uint32_t base_delay_micros;
         double delay_randomization_factor;
@@ -25,30 +51,90 @@ extern "C"
         uint64_t cqe_wait_timeout_millis;
         uint32_t cqe_wait_count;
         uint32_t cqe_peek_count;
+        bool wide_tags;
         bool trace;
     } transport_worker_configuration_t;
 
     typedef struct transport_worker
     {
         uint8_t id;
-        struct transport_buffers_pool free_buffers;
+        struct transport_buffers_class* buffer_classes;
+        uint8_t buffer_classes_count;
         struct io_uring* ring;
         struct iovec* buffers;
+        void* buffers_arena;
+        size_t buffers_arena_size;
+        bool zero_buffers;
+        bool huge_pages;
         uint32_t buffer_size;
-        uint16_t buffers_count;
+        uint32_t buffers_count;
+        uint32_t static_buffers_count;
+        uint32_t buffers_capacity;
+        uint32_t registered_buffers_count;
+        uint32_t buffers_grow_chunk;
+        uint64_t buffers_shrink_idle_millis;
+        uint64_t buffers_pressure_time;
+        struct transport_buffers_chunk* buffers_chunks;
+        uint32_t buffers_chunks_count;
+        uint64_t buffers_grows;
+        uint64_t buffers_shrinks;
+        uint16_t provided_buffers_count;
+        struct io_uring_buf_ring* provided_buffers;
+        uint32_t registered_files_count;
+        bool* registered_files;
+        bool link_timeouts;
+        struct __kernel_timespec* link_timeout_specs;
         uint64_t timeout_checker_period_millis;
         uint32_t base_delay_micros;
         double delay_randomization_factor;
         uint64_t max_delay_micros;
         struct msghdr* inet_used_messages;
         struct msghdr* unix_used_messages;
-        struct mh_events_t* events;
+        struct sockaddr_in* inet_used_addresses;
+        struct sockaddr_un* unix_used_addresses;
+        struct transport_events events;
+        bool wide_tags;
+        struct transport_tags tags;
+        struct transport_vectors vectors;
+        uint32_t* vector_buffer_ids;
+        uint32_t* buffer_references;
+        struct transport_framers framers;
+        struct transport_backlog frames;
+        struct transport_splices splices;
+        struct transport_streams streams;
+        struct transport_fd_events fd_events;
+        struct transport_timeouts timeouts;
         size_t ring_size;
         int ring_flags;
+        uint32_t submit_threshold;
+        struct transport_backlog backlog;
         struct io_uring_cqe** cqes;
         uint64_t cqe_wait_timeout_millis;
         uint32_t cqe_wait_count;
         uint32_t cqe_peek_count;
+        uint32_t* completion_fds;
+        uint32_t* completion_buffer_ids;
+        uint16_t* completion_events;
+        int32_t* completion_results;
+        uint32_t* completion_flags;
+        bool eventfd_wakeups;
+        bool parked;
+        bool chaining;
+        bool timeouts_armed;
+        bool wakeup_stopping;
+        int wakeup_fd;
+        pthread_t wakeup_watcher;
+        void (*wakeup_callback)(void);
+        bool io_thread;
+        int32_t io_thread_cpu;
+        bool io_thread_running;
+        bool io_thread_sleeping;
+        bool io_thread_stopping;
+        int io_thread_wakeup_fd;
+        uint64_t io_thread_wakeup_value;
+        pthread_t io_thread_handle;
+        struct transport_queue submissions;
+        struct transport_queue completions;
         bool trace;
     } transport_worker_t;
 
@@ -58,51 +144,121 @@ extern "C"
 
     void transport_worker_write(transport_worker_t* worker,
                                 uint32_t fd,
-                                uint16_t buffer_id,
+                                uint32_t buffer_id,
                                 uint32_t offset,
                                 int64_t timeout,
                                 uint16_t event,
                                 uint8_t sqe_flags);
+    int32_t transport_worker_write_vector(transport_worker_t* worker,
+                                          uint32_t fd,
+                                          uint32_t count,
+                                          uint32_t offset,
+                                          int64_t timeout,
+                                          uint16_t event,
+                                          uint8_t sqe_flags);
     void transport_worker_read(transport_worker_t* worker,
                                uint32_t fd,
-                               uint16_t buffer_id,
+                               uint32_t buffer_id,
                                uint32_t offset,
                                int64_t timeout,
                                uint16_t event,
                                uint8_t sqe_flags);
+    void transport_worker_send_zero_copy(transport_worker_t* worker,
+                                         uint32_t fd,
+                                         uint32_t buffer_id,
+                                         int64_t timeout,
+                                         uint16_t event,
+                                         uint8_t sqe_flags);
     void transport_worker_send_message(transport_worker_t* worker,
                                        uint32_t fd,
-                                       uint16_t buffer_id,
+                                       uint32_t buffer_id,
                                        struct sockaddr* address,
                                        transport_socket_family_t socket_family,
                                        int message_flags,
                                        int64_t timeout,
                                        uint16_t event,
                                        uint8_t sqe_flags);
+    void transport_worker_send_message_zero_copy(transport_worker_t* worker,
+                                                 uint32_t fd,
+                                                 uint32_t buffer_id,
+                                                 struct sockaddr* address,
+                                                 transport_socket_family_t socket_family,
+                                                 int message_flags,
+                                                 int64_t timeout,
+                                                 uint16_t event,
+                                                 uint8_t sqe_flags);
     void transport_worker_receive_message(transport_worker_t* worker,
                                           uint32_t fd,
-                                          uint16_t buffer_id,
+                                          uint32_t buffer_id,
                                           transport_socket_family_t socket_family,
                                           int message_flags,
                                           int64_t timeout,
                                           uint16_t event,
                                           uint8_t sqe_flags);
+    void transport_worker_read_multishot(transport_worker_t* worker,
+                                         uint32_t fd,
+                                         int64_t timeout,
+                                         uint16_t event,
+                                         uint8_t sqe_flags);
+    int32_t transport_worker_read_framed(transport_worker_t* worker,
+                                         uint32_t fd,
+                                         uint8_t mode,
+                                         uint8_t length_size,
+                                         uint8_t delimiter,
+                                         uint32_t max_frame_size,
+                                         int64_t timeout,
+                                         uint16_t event);
+    void transport_worker_clear_framing(transport_worker_t* worker, uint32_t fd);
+    int32_t transport_worker_read_stream(transport_worker_t* worker,
+                                         uint32_t fd,
+                                         uint32_t buffer_id,
+                                         int64_t timeout,
+                                         uint16_t event);
+    void transport_worker_clear_stream(transport_worker_t* worker, uint32_t fd);
+    int32_t transport_worker_send_file(transport_worker_t* worker,
+                                       uint32_t fd,
+                                       uint32_t source_fd,
+                                       uint64_t offset,
+                                       uint64_t length,
+                                       uint32_t chunk_size,
+                                       int64_t timeout,
+                                       uint16_t event);
+    int32_t transport_worker_proxy(transport_worker_t* worker, uint32_t fd, uint32_t peer_fd, uint32_t chunk_size);
+    void transport_worker_close_proxy(transport_worker_t* worker, uint32_t id);
+    void transport_worker_release_proxy(transport_worker_t* worker, uint32_t id);
     void transport_worker_connect(transport_worker_t* worker, transport_client_t* client, int64_t timeout);
     void transport_worker_accept(transport_worker_t* worker, transport_server_t* server);
+    void transport_worker_accept_multishot(transport_worker_t* worker, transport_server_t* server);
 
     void transport_worker_cancel_by_fd(transport_worker_t* worker, int fd);
 
+    int transport_worker_register_file(transport_worker_t* worker, int fd);
+    void transport_worker_unregister_file(transport_worker_t* worker, int fd);
+
     void transport_worker_check_event_timeouts(transport_worker_t* worker);
     void transport_worker_remove_event(transport_worker_t* worker, uint64_t data);
+    void transport_worker_touch_event(transport_worker_t* worker, uint64_t data);
 
     int32_t transport_worker_get_buffer(transport_worker_t* worker);
-    void transport_worker_release_buffer(transport_worker_t* worker, uint16_t buffer_id);
+    int32_t transport_worker_get_buffer_sized(transport_worker_t* worker, uint32_t size);
+    int32_t transport_worker_select_buffer_class(transport_worker_t* worker, uint32_t size);
+    void transport_worker_release_buffer(transport_worker_t* worker, uint32_t buffer_id);
+    int32_t transport_worker_share_buffer(transport_worker_t* worker, uint32_t buffer_id, uint32_t count);
     int32_t transport_worker_available_buffers(transport_worker_t* worker);
     int32_t transport_worker_used_buffers(transport_worker_t* worker);
+    int32_t transport_worker_available_class_buffers(transport_worker_t* worker, uint8_t buffer_class);
+    int32_t transport_worker_used_class_buffers(transport_worker_t* worker, uint8_t buffer_class);
+    int32_t transport_worker_grow_buffers(transport_worker_t* worker);
+    int32_t transport_worker_shrink_buffers(transport_worker_t* worker);
 
     struct sockaddr* transport_worker_get_datagram_address(transport_worker_t* worker, transport_socket_family_t socket_family, int buffer_id);
 
     int transport_worker_peek(transport_worker_t* worker);
+    int transport_worker_drain(transport_worker_t* worker);
+
+    bool transport_worker_park(transport_worker_t* worker);
+    int transport_worker_start_wakeups(transport_worker_t* worker, void (*callback)(void));
+    void transport_worker_stop_wakeups(transport_worker_t* worker);
 
     void transport_worker_destroy(transport_worker_t* worker);
 